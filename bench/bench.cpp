@@ -0,0 +1,780 @@
+#include "bench.hpp"
+
+#include <kj/async-io.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <future>
+#include <iomanip>
+
+bench::server::server(const std::string &address, const std::string &recording)
+{
+    std::promise<void> started;
+    std::future<void> result;
+
+    _received.store(0);
+    _latency.store(nullptr);
+    _connects = 0;
+    result = started.get_future();
+    _thread = std::thread(
+        [this, address, recording, started = std::move(started)]() mutable
+        {
+            try
+            {
+                _server = std::make_unique<netput::server>(address);
+                _server->set_recording(recording);
+            }
+            catch (...)
+            {
+                started.set_exception(std::current_exception());
+                return;
+            }
+            _server->handle_connect(
+                [this](const uint8_t *buffer, size_t size)
+                {
+                    // distinct ids so concurrent sessions spread over the server's session table
+                    return std::make_pair(true, "bench-session-" + std::to_string(_connects++));
+                });
+            _server->handle_disconnect(
+                [](const std::string &session_id)
+                {
+                    return true;
+                });
+            _server->handle_keyboard(
+                [this](const std::string &, uint64_t timestamp, uint32_t, netput::input_state, bool, uint32_t)
+                {
+                    receive(timestamp);
+                });
+            _server->handle_mouse_motion(
+                [this](const std::string &, uint64_t timestamp, uint32_t, const netput::mouse_button_state_mask &, int32_t, int32_t, int32_t, int32_t)
+                {
+                    receive(timestamp);
+                });
+            _server->handle_mouse_button(
+                [this](const std::string &, uint64_t timestamp, uint32_t, netput::mouse_button, netput::input_state, bool, int32_t, int32_t)
+                {
+                    receive(timestamp);
+                });
+            _server->handle_mouse_wheel(
+                [this](const std::string &, uint64_t timestamp, uint32_t, int32_t, int32_t, float, float)
+                {
+                    receive(timestamp);
+                });
+            _server->handle_window(
+                [this](const std::string &, uint64_t timestamp, uint32_t, netput::window_event, int32_t, int32_t)
+                {
+                    receive(timestamp);
+                });
+            started.set_value();
+            _server->serve();
+        });
+    try
+    {
+        result.get();
+    }
+    catch (...)
+    {
+        _thread.join();
+        throw;
+    }
+}
+
+bench::server::~server()
+{
+    _server->shutdown();
+    _thread.join();
+}
+
+uint64_t bench::server::received() const
+{
+    return _received.load(std::memory_order_acquire);
+}
+
+void bench::server::record_latency(histogram *latency)
+{
+    _latency.store(latency);
+}
+
+netput::server_stats bench::server::stats() const
+{
+    return _server->stats();
+}
+
+void bench::server::receive(uint64_t timestamp)
+{
+    histogram *latency = _latency.load(std::memory_order_relaxed);
+    if (latency != nullptr)
+    {
+        latency->record(bench::monotonic_ns() - timestamp);
+    }
+    // publishes the histogram update to whoever observes the new count
+    _received.fetch_add(1, std::memory_order_release);
+}
+
+bench::histogram::histogram()
+{
+    _counts.resize((bucket_count + 2) << (sub_bucket_bits - 1));
+    _total = 0;
+    _max = 0;
+}
+
+void bench::histogram::record(uint64_t value)
+{
+    _counts[index_of(value)]++;
+    _total++;
+    _max = std::max(_max, value);
+}
+
+uint64_t bench::histogram::percentile(double percent) const
+{
+    const uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percent / 100.0 * _total)));
+    uint64_t seen;
+    uint64_t result;
+
+    seen = 0;
+    result = 0;
+    for (size_t index = 0; index < _counts.size(); index++)
+    {
+        seen += _counts[index];
+        if (seen >= target)
+        {
+            result = std::min(highest_equivalent_value(index), _max);
+            break;
+        }
+    }
+    return result;
+}
+
+uint64_t bench::histogram::max() const
+{
+    return _max;
+}
+
+uint64_t bench::histogram::count() const
+{
+    return _total;
+}
+
+// bucket 0 holds 0..2^bits-1 exactly, every later bucket covers one power of two
+// with 2^(bits-1) linear sub-buckets
+size_t bench::histogram::index_of(uint64_t value) const
+{
+    const uint64_t sub_bucket_count = uint64_t(1) << sub_bucket_bits;
+    unsigned bucket;
+
+    bucket = 0;
+    while (bucket < bucket_count && (value >> bucket) >= sub_bucket_count)
+    {
+        bucket++;
+    }
+    value = std::min(value >> bucket, sub_bucket_count - 1);
+    return (static_cast<size_t>(bucket) << (sub_bucket_bits - 1)) + static_cast<size_t>(value);
+}
+
+uint64_t bench::histogram::highest_equivalent_value(size_t index) const
+{
+    const size_t half_count = size_t(1) << (sub_bucket_bits - 1);
+    size_t bucket;
+    uint64_t sub_bucket;
+
+    bucket = (index < 2 * half_count) ? 0 : (index / half_count) - 1;
+    sub_bucket = index - (bucket << (sub_bucket_bits - 1));
+    return ((sub_bucket + 1) << bucket) - 1;
+}
+
+class bench::relay::implementation final : public kj::TaskSet::ErrorHandler
+{
+public:
+    implementation(uint16_t listen_port, uint16_t target_port)
+    {
+        std::promise<void> started;
+        std::future<void> result;
+
+        _bytes.store(0);
+        _connections.store(0);
+        result = started.get_future();
+        _thread = std::thread(
+            [this, listen_port, target_port, started = std::move(started)]() mutable
+            {
+                run(listen_port, target_port, started);
+            });
+        try
+        {
+            result.get();
+        }
+        catch (...)
+        {
+            _thread.join();
+            throw;
+        }
+    }
+
+    ~implementation()
+    {
+        _shutdown->fulfill();
+        _thread.join();
+    }
+
+    void taskFailed(kj::Exception &&exception) override
+    {
+        // a reset connection still has to finish so nobody waits on it forever
+        _connections.fetch_add(1);
+    }
+
+    std::atomic<uint64_t> _bytes;
+    std::atomic<uint64_t> _connections;
+
+private:
+    void run(uint16_t listen_port, uint16_t target_port, std::promise<void> &started)
+    {
+        bool running;
+
+        running = false;
+        try
+        {
+            auto io = kj::setupAsyncIo();
+            auto &network = io.provider->getNetwork();
+            auto listen_address = network.parseAddress(bench::loopback, listen_port).wait(io.waitScope);
+            auto listener = listen_address->listen();
+            auto target = network.parseAddress(bench::loopback, target_port).wait(io.waitScope);
+            kj::TaskSet tasks(*this);
+            auto paf = kj::newPromiseAndCrossThreadFulfiller<void>();
+
+            _target = target.get();
+            _tasks = &tasks;
+            _shutdown = kj::mv(paf.fulfiller);
+            running = true;
+            started.set_value();
+            paf.promise.exclusiveJoin(accept(*listener)).wait(io.waitScope);
+        }
+        catch (...)
+        {
+            if (!running)
+            {
+                started.set_exception(std::current_exception());
+            }
+        }
+    }
+
+    kj::Promise<void> accept(kj::ConnectionReceiver &listener)
+    {
+        return listener.accept().then(
+            [this, &listener](kj::Own<kj::AsyncIoStream> &&connection)
+            {
+                _tasks->add(forward(kj::mv(connection)));
+                return accept(listener);
+            });
+    }
+
+    kj::Promise<void> forward(kj::Own<kj::AsyncIoStream> &&connection)
+    {
+        return _target->connect().then(
+            [this, connection = kj::mv(connection)](kj::Own<kj::AsyncIoStream> &&upstream) mutable
+            {
+                kj::AsyncIoStream &client = *connection;
+                kj::AsyncIoStream &server = *upstream;
+                auto pumps = kj::heapArrayBuilder<kj::Promise<uint64_t>>(2);
+                pumps.add(client.pumpTo(server).then(
+                    [&server](uint64_t bytes)
+                    {
+                        server.shutdownWrite();
+                        return bytes;
+                    }));
+                pumps.add(server.pumpTo(client).then(
+                    [&client](uint64_t bytes)
+                    {
+                        client.shutdownWrite();
+                        return bytes;
+                    }));
+                const auto finished = [this](kj::Array<uint64_t> &&bytes)
+                {
+                    _bytes.fetch_add(bytes[0] + bytes[1]);
+                    _connections.fetch_add(1);
+                };
+                return kj::joinPromises(pumps.finish()).then(finished).attach(kj::mv(connection), kj::mv(upstream));
+            });
+    }
+
+    std::thread _thread;
+    kj::NetworkAddress *_target;
+    kj::TaskSet *_tasks;
+    kj::Own<kj::CrossThreadPromiseFulfiller<void>> _shutdown;
+};
+
+bench::relay::relay(uint16_t listen_port, uint16_t target_port)
+{
+    _implementation = std::make_unique<implementation>(listen_port, target_port);
+}
+
+bench::relay::~relay() = default;
+
+uint64_t bench::relay::bytes() const
+{
+    return _implementation->_bytes.load();
+}
+
+uint64_t bench::relay::connections() const
+{
+    return _implementation->_connections.load();
+}
+
+void bench::throughput(size_t events)
+{
+    std::cout << std::fixed << std::setprecision(3);
+    for (transport kind_of_transport : bench::transports)
+    {
+        server target(server_address(kind_of_transport, bench::port));
+        const std::string address = client_address(kind_of_transport, bench::port);
+        // the relay only speaks tcp, the encoding and so the bytes per event are the same on either transport
+        std::unique_ptr<relay> wire;
+        if (kind_of_transport == transport::tcp)
+        {
+            wire = std::make_unique<relay>(bench::relay_port, bench::port);
+        }
+        for (mode send_mode : bench::modes)
+        {
+            for (workload kind : bench::workloads)
+            {
+                const result timed = bench::run(send_mode, kind, events, address, target);
+
+                std::cout << "{\"benchmark\":\"throughput\""
+                          << ",\"transport\":\"" << transport_name(kind_of_transport) << "\""
+                          << ",\"mode\":\"" << mode_name(send_mode) << "\""
+                          << ",\"workload\":\"" << workload_name(kind) << "\""
+                          << ",\"events\":" << timed.events
+                          << ",\"seconds\":" << timed.seconds
+                          << ",\"events_per_second\":" << timed.events / timed.seconds;
+                if (wire)
+                {
+                    const uint64_t bytes_before = wire->bytes();
+                    const uint64_t connections_before = wire->connections();
+                    bench::run(send_mode, kind, bench::wire_events, client_address(transport::tcp, bench::relay_port), target);
+                    wait_until(
+                        [&]()
+                        {
+                            return wire->connections() > connections_before;
+                        },
+                        std::chrono::seconds(10));
+                    std::cout << ",\"bytes_per_event\":" << static_cast<double>(wire->bytes() - bytes_before) / bench::wire_events;
+                }
+                std::cout << ",\"cpu_ns_per_event\":" << timed.cpu_seconds * 1e9 / timed.events
+                          << "}" << std::endl;
+            }
+        }
+    }
+}
+
+void bench::latency(size_t events, size_t rate)
+{
+    std::cout << std::fixed << std::setprecision(3);
+    for (transport kind_of_transport : bench::transports)
+    {
+        server target(server_address(kind_of_transport, bench::port));
+        const std::string address = client_address(kind_of_transport, bench::port);
+        for (mode send_mode : bench::modes)
+        {
+            for (workload kind : bench::workloads)
+            {
+                histogram latency;
+                bench::run_latency(send_mode, kind, events, rate, address, target, latency);
+                std::cout << "{\"benchmark\":\"latency\""
+                          << ",\"transport\":\"" << transport_name(kind_of_transport) << "\""
+                          << ",\"mode\":\"" << mode_name(send_mode) << "\""
+                          << ",\"workload\":\"" << workload_name(kind) << "\""
+                          << ",\"events\":" << latency.count()
+                          << ",\"rate\":" << rate
+                          << ",\"p50_us\":" << latency.percentile(50.0) / 1e3
+                          << ",\"p90_us\":" << latency.percentile(90.0) / 1e3
+                          << ",\"p99_us\":" << latency.percentile(99.0) / 1e3
+                          << ",\"p99_9_us\":" << latency.percentile(99.9) / 1e3
+                          << ",\"max_us\":" << latency.max() / 1e3
+                          << "}" << std::endl;
+            }
+        }
+    }
+}
+
+void bench::recording(size_t events)
+{
+    const mode recorded_modes[] = {mode::pipelined, mode::batched};
+    const std::string address = client_address(transport::tcp, bench::port);
+    double events_per_second[2];
+    std::ifstream log;
+
+    std::cout << std::fixed << std::setprecision(3);
+    for (mode send_mode : recorded_modes)
+    {
+        std::remove(bench::recording_path.c_str());
+        for (size_t recorded = 0; recorded < 2; recorded++)
+        {
+            // the log is complete once the server, and with it the recorder, is gone
+            server target(server_address(transport::tcp, bench::port), (recorded == 1) ? bench::recording_path : std::string());
+            const result timed = bench::run(send_mode, workload::mixed, events, address, target);
+            events_per_second[recorded] = timed.events / timed.seconds;
+        }
+        log.open(bench::recording_path, std::ios::binary | std::ios::ate);
+        std::cout << "{\"benchmark\":\"recording\""
+                  << ",\"mode\":\"" << mode_name(send_mode) << "\""
+                  << ",\"events\":" << events
+                  << ",\"events_per_second\":" << events_per_second[0]
+                  << ",\"recorded_events_per_second\":" << events_per_second[1]
+                  << ",\"overhead_percent\":" << (1.0 - events_per_second[1] / events_per_second[0]) * 100.0
+                  << ",\"log_bytes_per_event\":" << static_cast<double>(log.tellg()) / events
+                  << "}" << std::endl;
+        log.close();
+    }
+    std::remove(bench::recording_path.c_str());
+}
+
+void bench::replay(const std::string &path, const std::string &address, const std::string &mode, double speed, uint64_t timestamp_ns)
+{
+    netput::replay_options options;
+    netput::replay_stats played;
+
+    if (mode == "original")
+    {
+        options.mode = netput::replay_mode::original;
+    }
+    else if (mode == "scaled")
+    {
+        options.mode = netput::replay_mode::scaled;
+    }
+    else if (mode == "maximum")
+    {
+        options.mode = netput::replay_mode::maximum;
+    }
+    else
+    {
+        throw std::runtime_error("unknown replay mode " + mode);
+    }
+    options.speed = speed;
+    options.timestamp_ns = timestamp_ns;
+    played = netput::replay(path).play(address, options);
+
+    std::cout << std::fixed << std::setprecision(3)
+              << "{\"benchmark\":\"replay\""
+              << ",\"mode\":\"" << mode << "\""
+              << ",\"speed\":" << ((options.mode == netput::replay_mode::scaled) ? speed : 1.0)
+              << ",\"sessions\":" << played.sessions
+              << ",\"events\":" << played.events
+              << ",\"seconds\":" << played.seconds
+              << ",\"events_per_second\":" << played.events_per_second
+              << ",\"mean_error_us\":" << played.mean_error_ns / 1e3
+              << ",\"max_error_us\":" << played.max_error_ns / 1e3
+              << "}" << std::endl;
+}
+
+const char *bench::mode_name(mode send_mode)
+{
+    const char *result;
+    switch (send_mode)
+    {
+    case mode::blocking:
+        result = "blocking";
+        break;
+    case mode::pipelined:
+        result = "pipelined";
+        break;
+    case mode::streaming:
+        result = "streaming";
+        break;
+    case mode::batched:
+        result = "batched";
+        break;
+    case mode::background:
+        result = "background";
+        break;
+    }
+    return result;
+}
+
+const char *bench::transport_name(transport kind)
+{
+    const char *result;
+    switch (kind)
+    {
+    case transport::tcp:
+        result = "tcp";
+        break;
+    case transport::unix_socket:
+        result = "unix";
+        break;
+    case transport::shared_memory:
+        result = "shm";
+        break;
+    }
+    return result;
+}
+
+std::string bench::client_address(transport kind, uint16_t port)
+{
+    std::string result;
+    switch (kind)
+    {
+    case transport::tcp:
+        result = bench::loopback + ":" + std::to_string(port);
+        break;
+    case transport::unix_socket:
+        result = "unix:" + bench::unix_path;
+        break;
+    case transport::shared_memory:
+        result = "shm:" + bench::shm_name;
+        break;
+    }
+    return result;
+}
+
+std::string bench::server_address(transport kind, uint16_t port)
+{
+    return (kind == transport::tcp) ? bench::localhost + ":" + std::to_string(port) : client_address(kind, port);
+}
+
+const char *bench::workload_name(workload kind)
+{
+    const char *result;
+    switch (kind)
+    {
+    case workload::keyboard:
+        result = "keyboard";
+        break;
+    case workload::mouse_motion:
+        result = "mouse_motion";
+        break;
+    case workload::mouse_button:
+        result = "mouse_button";
+        break;
+    case workload::mouse_wheel:
+        result = "mouse_wheel";
+        break;
+    case workload::window:
+        result = "window";
+        break;
+    case workload::mixed:
+        result = "mixed";
+        break;
+    }
+    return result;
+}
+
+std::unique_ptr<netput::client> bench::connect(mode send_mode, const std::string &address)
+{
+    const std::string user_data = "bench";
+    std::unique_ptr<netput::client> client;
+    bool connected;
+
+    if (send_mode == mode::background)
+    {
+        client = std::make_unique<netput::client>(address, netput::io_mode::background_thread);
+    }
+    else
+    {
+        client = std::make_unique<netput::client>(address);
+    }
+
+    // connect while blocking so a refused connection surfaces here rather than in the error handler
+    wait_until(
+        [&]()
+        {
+            connected = true;
+            try
+            {
+                client->connect(reinterpret_cast<const uint8_t *>(user_data.data()), user_data.size());
+            }
+            catch (...)
+            {
+                connected = false;
+            }
+            return connected;
+        },
+        std::chrono::seconds(5));
+
+    switch (send_mode)
+    {
+    case mode::pipelined:
+    case mode::background:
+        client->set_send_mode(netput::send_mode::pipelined);
+        break;
+    case mode::streaming:
+        client->set_send_mode(netput::send_mode::streaming);
+        break;
+    default:
+        break;
+    }
+
+    return client;
+}
+
+void bench::send_event(netput::client &client, workload kind, size_t index, uint64_t timestamp)
+{
+    const uint32_t window_id = 1;
+    const int32_t position = static_cast<int32_t>(index % 1024);
+    const netput::mouse_button_state_mask state_mask = {
+        netput::input_state::released,
+        netput::input_state::released,
+        netput::input_state::released,
+        netput::input_state::released,
+        netput::input_state::released,
+    };
+    workload selected;
+
+    selected = kind;
+    if (kind == workload::mixed)
+    {
+        // roughly what a desktop session produces: mostly motion, some clicks and typing
+        switch (index % 20)
+        {
+        case 14:
+        case 15:
+            selected = workload::mouse_button;
+            break;
+        case 16:
+            selected = workload::mouse_wheel;
+            break;
+        case 17:
+        case 18:
+            selected = workload::keyboard;
+            break;
+        case 19:
+            selected = workload::window;
+            break;
+        default:
+            selected = workload::mouse_motion;
+            break;
+        }
+    }
+
+    switch (selected)
+    {
+    case workload::keyboard:
+        client.send_keyboard(timestamp, window_id, (index % 2 == 0) ? netput::input_state::pressed : netput::input_state::released, false, static_cast<uint32_t>('a' + index % 26));
+        break;
+    case workload::mouse_motion:
+        client.send_mouse_motion(timestamp, window_id, state_mask, position, position, 1, 1);
+        break;
+    case workload::mouse_button:
+        client.send_mouse_button(timestamp, window_id, netput::mouse_button::left, (index % 2 == 0) ? netput::input_state::pressed : netput::input_state::released, false, position, position);
+        break;
+    case workload::mouse_wheel:
+        client.send_mouse_wheel(timestamp, window_id, 0, 1, 0.0f, 1.0f);
+        break;
+    case workload::window:
+        client.send_window(timestamp, window_id, netput::window_event::moved, position, position);
+        break;
+    default:
+        break;
+    }
+}
+
+bench::result bench::run(mode send_mode, workload kind, size_t events, const std::string &address, const server &target)
+{
+    std::unique_ptr<netput::client> client;
+    std::chrono::steady_clock::time_point start;
+    std::clock_t cpu_start;
+    uint64_t received;
+    result measured;
+
+    client = bench::connect(send_mode, address);
+    received = target.received();
+
+    start = std::chrono::steady_clock::now();
+    cpu_start = std::clock();
+    if (send_mode == mode::batched)
+    {
+        client->begin_batch();
+    }
+    for (size_t index = 0; index < events; index++)
+    {
+        bench::send_event(*client, kind, index, index);
+        if (send_mode == mode::batched && (index + 1) % bench::batch_size == 0)
+        {
+            client->send_batch();
+            client->begin_batch();
+        }
+    }
+    if (send_mode == mode::batched)
+    {
+        client->send_batch();
+    }
+    client->flush();
+    wait_until(
+        [&]()
+        {
+            return target.received() - received >= events;
+        },
+        std::chrono::seconds(60));
+
+    measured.events = events;
+    measured.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    measured.cpu_seconds = static_cast<double>(std::clock() - cpu_start) / CLOCKS_PER_SEC;
+
+    client->disconnect();
+    return measured;
+}
+
+void bench::run_latency(mode send_mode, workload kind, size_t events, size_t rate, const std::string &address, server &target, histogram &latency)
+{
+    const std::chrono::nanoseconds interval(1000000000 / rate);
+    std::unique_ptr<netput::client> client;
+    std::chrono::steady_clock::time_point next;
+    uint64_t received;
+
+    client = bench::connect(send_mode, address);
+    received = target.received();
+    target.record_latency(&latency);
+
+    next = std::chrono::steady_clock::now();
+    if (send_mode == mode::batched)
+    {
+        client->begin_batch();
+    }
+    for (size_t index = 0; index < events; index++)
+    {
+        // paced like a polling input device so the numbers show latency rather than queueing
+        std::this_thread::sleep_until(next);
+        next += interval;
+        bench::send_event(*client, kind, index, bench::monotonic_ns());
+        if (send_mode == mode::batched && (index + 1) % bench::batch_size == 0)
+        {
+            client->send_batch();
+            client->begin_batch();
+        }
+    }
+    if (send_mode == mode::batched)
+    {
+        client->send_batch();
+    }
+    client->flush();
+    wait_until(
+        [&]()
+        {
+            return target.received() - received >= events;
+        },
+        std::chrono::seconds(60));
+
+    target.record_latency(nullptr);
+    client->disconnect();
+}
+
+uint64_t bench::monotonic_ns()
+{
+    return static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+            .count());
+}
+
+void bench::wait_until(const std::function<bool()> &condition, std::chrono::seconds timeout)
+{
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    while (!condition())
+    {
+        if (std::chrono::steady_clock::now() - start > timeout)
+        {
+            throw std::runtime_error("timed out waiting for the benchmark to complete");
+        }
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
@@ -0,0 +1,189 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+
+#include <netput.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace bench
+{
+    const std::string localhost = "0.0.0.0";
+    const std::string loopback = "127.0.0.1";
+    const uint16_t port = 12350;
+    const uint16_t relay_port = 12351;
+    const std::string unix_path = "/tmp/netput_bench.sock";
+    const std::string shm_name = "/netput_bench";
+    const std::string recording_path = "/tmp/netput_bench.log";
+    const size_t default_events = 100000;
+    const size_t default_latency_events = 2000;
+    const size_t default_latency_rate = 1000;
+    const size_t wire_events = 1000;
+    const size_t batch_size = 64;
+    const size_t load_threads = 8;
+    const size_t load_tick_us = 500;
+
+    enum class mode
+    {
+        blocking,
+        pipelined,
+        streaming,
+        batched,
+        background,
+    };
+
+    enum class transport
+    {
+        tcp,
+        unix_socket,
+        shared_memory,
+    };
+
+    enum class workload
+    {
+        keyboard,
+        mouse_motion,
+        mouse_button,
+        mouse_wheel,
+        window,
+        mixed,
+    };
+
+    const mode modes[] = {
+        mode::blocking,
+        mode::pipelined,
+        mode::streaming,
+        mode::batched,
+        mode::background,
+    };
+
+    const transport transports[] = {
+        transport::tcp,
+        transport::unix_socket,
+#ifdef __linux__
+        transport::shared_memory,
+#endif
+    };
+
+    const workload workloads[] = {
+        workload::keyboard,
+        workload::mouse_motion,
+        workload::mouse_button,
+        workload::mouse_wheel,
+        workload::window,
+        workload::mixed,
+    };
+
+    // what every session of the load benchmark sends
+    struct load_profile
+    {
+        size_t motion_hz;
+        // typing_burst key presses and releases every typing_interval_ms
+        size_t typing_burst;
+        size_t typing_interval_ms;
+        // resize_storm window resizes every resize_interval_ms
+        size_t resize_storm;
+        size_t resize_interval_ms;
+        size_t seconds;
+        std::string user_data;
+    };
+
+    const load_profile default_load_profile = {1000, 8, 2000, 20, 5000, 10, "bench"};
+
+    struct result
+    {
+        size_t events;
+        double seconds;
+        double cpu_seconds;
+    };
+
+    // log-linear latency histogram in the style of HdrHistogram, about 0.1% value precision
+    class histogram
+    {
+    public:
+        histogram();
+        void record(uint64_t value);
+        uint64_t percentile(double percent) const;
+        uint64_t max() const;
+        uint64_t count() const;
+
+    private:
+        static const unsigned sub_bucket_bits = 11;
+        static const unsigned bucket_count = 40;
+
+        size_t index_of(uint64_t value) const;
+        uint64_t highest_equivalent_value(size_t index) const;
+
+        std::vector<uint64_t> _counts;
+        uint64_t _total;
+        uint64_t _max;
+    };
+
+    // in-process server that counts everything it receives, recording it to recording when not empty
+    class server
+    {
+    public:
+        server(const std::string &address, const std::string &recording = std::string());
+        ~server();
+        uint64_t received() const;
+        void record_latency(histogram *latency);
+        netput::server_stats stats() const;
+
+    private:
+        void receive(uint64_t timestamp);
+
+        std::unique_ptr<netput::server> _server;
+        std::thread _thread;
+        std::atomic<uint64_t> _received;
+        std::atomic<histogram *> _latency;
+        uint64_t _connects;
+    };
+
+    // loopback tcp relay that counts the bytes of every connection it forwards
+    class relay
+    {
+    public:
+        relay(uint16_t listen_port, uint16_t target_port);
+        ~relay();
+        uint64_t bytes() const;
+        uint64_t connections() const;
+
+    private:
+        class implementation;
+
+        std::unique_ptr<implementation> _implementation;
+    };
+
+    void throughput(size_t events);
+    void latency(size_t events, size_t rate);
+    // throughput of the mixed workload with and without server::set_recording
+    void recording(size_t events);
+    // sessions each connected through its own client and driven by profile, for every count in
+    // session_counts; reports server throughput, latency and the rss of the process, clients included
+    void load(const std::vector<size_t> &session_counts, const load_profile &profile);
+    // plays a server recording against address, mode is original, scaled or maximum
+    void replay(const std::string &path, const std::string &address, const std::string &mode, double speed, uint64_t timestamp_ns);
+
+    const char *mode_name(mode send_mode);
+    const char *transport_name(transport kind);
+    const char *workload_name(workload kind);
+
+    // client side address, the server listens on the same unix path or on every interface
+    std::string client_address(transport kind, uint16_t port);
+    std::string server_address(transport kind, uint16_t port);
+    std::unique_ptr<netput::client> connect(mode send_mode, const std::string &address);
+    void send_event(netput::client &client, workload kind, size_t index, uint64_t timestamp);
+    result run(mode send_mode, workload kind, size_t events, const std::string &address, const server &target);
+    void run_latency(mode send_mode, workload kind, size_t events, size_t rate, const std::string &address, server &target, histogram &latency);
+    uint64_t monotonic_ns();
+    void wait_until(const std::function<bool()> &condition, std::chrono::seconds timeout);
+}
+
+#endif
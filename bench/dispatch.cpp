@@ -0,0 +1,219 @@
+// per-event decode and handler cost of both servers without any rpc traffic: the same pre-built
+// batch goes through netput::server's receive path and through basic_server's compile-time
+// dispatch. Built from the library source, like the white-box tests, so it can reach
+// netput::internal
+#include "../src/netput.cpp"
+
+#include <netput_basic_server.hpp>
+
+#include <capnp/message.h>
+
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+
+namespace dispatch
+{
+    const std::string address = "127.0.0.1:12352";
+    const std::string session_id = "bench";
+    const size_t message_events = 1024;
+    const size_t default_events = 10000000;
+
+    // every on_* inline, the compile-time dispatch case
+    struct inline_handler
+    {
+        uint64_t sum = 0;
+
+        void on_keyboard(const std::string &, uint64_t timestamp, uint32_t, netput::input_state, bool, uint32_t key_code)
+        {
+            sum += timestamp + key_code;
+        }
+
+        void on_mouse_motion(const std::string &, uint64_t timestamp, uint32_t, const netput::mouse_button_state_mask &, int32_t x, int32_t y, int32_t, int32_t)
+        {
+            sum += timestamp + x + y;
+        }
+
+        void on_mouse_button(const std::string &, uint64_t timestamp, uint32_t, netput::mouse_button button, netput::input_state, bool, int32_t, int32_t)
+        {
+            sum += timestamp + button;
+        }
+
+        void on_mouse_wheel(const std::string &, uint64_t timestamp, uint32_t, int32_t, int32_t y, float, float)
+        {
+            sum += timestamp + y;
+        }
+
+        void on_window(const std::string &, uint64_t timestamp, uint32_t, netput::window_event type, int32_t, int32_t)
+        {
+            sum += timestamp + type;
+        }
+    };
+
+    // only keyboard, the other four decoders compile away
+    struct keyboard_handler
+    {
+        uint64_t sum = 0;
+
+        void on_keyboard(const std::string &, uint64_t timestamp, uint32_t, netput::input_state, bool, uint32_t key_code)
+        {
+            sum += timestamp + key_code;
+        }
+    };
+
+    // the mixed workload as one pre-built batch
+    static void build_events(capnp::MallocMessageBuilder &message)
+    {
+        netput::rpc::EventBatch::Builder batch = message.initRoot<netput::rpc::EventBatch>();
+        batch.setSessionId(session_id);
+        capnp::List<netput::rpc::Event>::Builder events = batch.initEvents(message_events);
+        for (size_t index = 0; index < message_events; index++)
+        {
+            netput::rpc::Event::Info::Builder info = events[index].initInfo();
+            const int32_t position = static_cast<int32_t>(index);
+            switch (index % 5)
+            {
+            case 0:
+            {
+                auto keyboard = info.initKeyboard();
+                keyboard.setTimestamp(index);
+                keyboard.setKeyCode(static_cast<uint32_t>('a' + index % 26));
+                break;
+            }
+            case 1:
+            {
+                auto mouse_motion = info.initMouseMotion();
+                mouse_motion.setTimestamp(index);
+                mouse_motion.setX(position);
+                mouse_motion.setY(position);
+                break;
+            }
+            case 2:
+            {
+                auto mouse_button = info.initMouseButton();
+                mouse_button.setTimestamp(index);
+                mouse_button.setButton(netput::rpc::MouseButton::RIGHT);
+                break;
+            }
+            case 3:
+            {
+                auto mouse_wheel = info.initMouseWheel();
+                mouse_wheel.setTimestamp(index);
+                mouse_wheel.setY(1);
+                break;
+            }
+            default:
+            {
+                auto window = info.initWindow();
+                window.setTimestamp(index);
+                window.setType(netput::rpc::WindowEventType::FOCUS_GAINED_TYPE);
+                break;
+            }
+            }
+        }
+    }
+
+    static uint64_t monotonic_ns()
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+    }
+
+    static void report(const char *server, const char *handler, size_t rounds, uint64_t elapsed, uint64_t checksum)
+    {
+        std::cout << "{\"benchmark\":\"dispatch\""
+                  << ",\"server\":\"" << server << "\""
+                  << ",\"handler\":\"" << handler << "\""
+                  << ",\"events\":" << rounds * message_events
+                  << ",\"ns_per_event\":" << static_cast<double>(elapsed) / (rounds * message_events)
+                  << ",\"checksum\":" << checksum
+                  << "}" << std::endl;
+    }
+
+    // what a basic_server session runs for every pushBatch
+    template <typename Handler>
+    static void run_basic(const char *name, size_t events, const netput::rpc::EventBatch::Reader &batch)
+    {
+        netput::internal::basic_dispatcher<Handler> dispatcher;
+        uint64_t start;
+        size_t rounds;
+
+        rounds = std::max<size_t>(1, events / message_events);
+        start = monotonic_ns();
+        for (size_t round = 0; round < rounds; round++)
+        {
+            dispatcher.dispatch(session_id, batch.getEvents());
+        }
+        report("basic_server", name, rounds, monotonic_ns() - start, dispatcher.handler().sum);
+    }
+
+    // netput::server's own receive path for a pushBatch: decode into event records, then the
+    // std::function handlers on the i/o thread
+    static void run_server(const char *name, size_t events, const netput::rpc::EventBatch::Reader &batch, bool keyboard_only)
+    {
+        netput::internal::server server(address);
+        uint64_t sum;
+        uint64_t start;
+        size_t rounds;
+
+        sum = 0;
+        server._keyboard_handler = [&sum](const std::string &, uint64_t timestamp, uint32_t, netput::input_state, bool, uint32_t key_code)
+        {
+            sum += timestamp + key_code;
+        };
+        if (!keyboard_only)
+        {
+            server._mouse_motion_handler = [&sum](const std::string &, uint64_t timestamp, uint32_t, const netput::mouse_button_state_mask &, int32_t x, int32_t y, int32_t, int32_t)
+            {
+                sum += timestamp + x + y;
+            };
+            server._mouse_button_handler = [&sum](const std::string &, uint64_t timestamp, uint32_t, netput::mouse_button button, netput::input_state, bool, int32_t, int32_t)
+            {
+                sum += timestamp + button;
+            };
+            server._mouse_wheel_handler = [&sum](const std::string &, uint64_t timestamp, uint32_t, int32_t, int32_t y, float, float)
+            {
+                sum += timestamp + y;
+            };
+            server._window_handler = [&sum](const std::string &, uint64_t timestamp, uint32_t, netput::window_event type, int32_t, int32_t)
+            {
+                sum += timestamp + type;
+            };
+        }
+
+        rounds = std::max<size_t>(1, events / message_events);
+        start = monotonic_ns();
+        for (size_t round = 0; round < rounds; round++)
+        {
+            server.handle_push_batch(batch);
+        }
+        report("server", name, rounds, monotonic_ns() - start, sum);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int result;
+    size_t events;
+    try
+    {
+        result = 0;
+        events = (argc > 1) ? std::stoul(argv[1]) : dispatch::default_events;
+        capnp::MallocMessageBuilder message;
+        dispatch::build_events(message);
+        const netput::rpc::EventBatch::Reader batch = message.getRoot<netput::rpc::EventBatch>().asReader();
+
+        std::cout << std::fixed << std::setprecision(3);
+        dispatch::run_server("all", events, batch, false);
+        dispatch::run_basic<dispatch::inline_handler>("all", events, batch);
+        dispatch::run_server("keyboard_only", events, batch, true);
+        dispatch::run_basic<dispatch::keyboard_handler>("keyboard_only", events, batch);
+    }
+    catch (const std::exception &error)
+    {
+        result = 1;
+        std::cerr << error.what() << std::endl;
+    }
+    return result;
+}
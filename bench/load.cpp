@@ -0,0 +1,274 @@
+#include "bench.hpp"
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <random>
+
+namespace
+{
+    // one simulated user: a steady stream of motion with typing bursts and resize storms on top
+    struct session
+    {
+        std::unique_ptr<netput::client> client;
+        uint64_t next_motion_ns;
+        uint64_t next_typing_ns;
+        uint64_t next_resize_ns;
+        int32_t x;
+    };
+
+    // a generator thread owns its clients, they share the thread's event loop
+    struct generator
+    {
+        std::thread thread;
+        std::vector<session> sessions;
+        uint64_t sent = 0;
+        std::exception_ptr error;
+    };
+
+    size_t resident_bytes()
+    {
+        size_t result;
+        result = 0;
+#ifdef __linux__
+        std::ifstream statm("/proc/self/statm");
+        size_t pages;
+        size_t resident_pages;
+        if (statm >> pages >> resident_pages)
+        {
+            result = resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        }
+#endif
+        return result;
+    }
+
+    // every session holds a socket on both ends of the loopback
+    void raise_descriptor_limit()
+    {
+#ifdef __linux__
+        struct rlimit limit;
+        if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max)
+        {
+            limit.rlim_cur = limit.rlim_max;
+            setrlimit(RLIMIT_NOFILE, &limit);
+        }
+#endif
+    }
+
+    void send_due(session &user, const bench::load_profile &profile, uint64_t now, uint64_t &sent)
+    {
+        const uint64_t motion_interval = 1000000000 / std::max<size_t>(profile.motion_hz, 1);
+        const netput::mouse_button_state_mask state_mask = {netput::input_state::released, netput::input_state::released, netput::input_state::released, netput::input_state::released, netput::input_state::released};
+
+        // a generator that falls behind sends the backlog, so the offered rate shows in sent
+        while (profile.motion_hz > 0 && user.next_motion_ns <= now)
+        {
+            user.x++;
+            user.client->send_mouse_motion(bench::monotonic_ns(), 1, state_mask, user.x, user.x % 1080, 1, 1);
+            user.next_motion_ns += motion_interval;
+            sent++;
+        }
+        if (profile.typing_burst > 0 && user.next_typing_ns <= now)
+        {
+            for (size_t key = 0; key < profile.typing_burst; key++)
+            {
+                const uint32_t key_code = static_cast<uint32_t>('a' + key % 26);
+                user.client->send_keyboard(bench::monotonic_ns(), 1, netput::input_state::pressed, false, key_code);
+                user.client->send_keyboard(bench::monotonic_ns(), 1, netput::input_state::released, false, key_code);
+            }
+            user.next_typing_ns += profile.typing_interval_ms * 1000000;
+            sent += 2 * profile.typing_burst;
+        }
+        if (profile.resize_storm > 0 && user.next_resize_ns <= now)
+        {
+            for (size_t resize = 0; resize < profile.resize_storm; resize++)
+            {
+                const int32_t width = static_cast<int32_t>(640 + resize);
+                user.client->send_window(bench::monotonic_ns(), 1, netput::window_event::resized, width, width * 9 / 16);
+            }
+            user.next_resize_ns += profile.resize_interval_ms * 1000000;
+            sent += profile.resize_storm;
+        }
+    }
+
+    void run_generator(
+        generator &worker,
+        size_t sessions,
+        const std::string &address,
+        const bench::load_profile &profile,
+        std::atomic<size_t> &connected,
+        const std::atomic<uint64_t> &start_ns,
+        const std::atomic<uint64_t> &end_ns)
+    {
+        std::mt19937_64 phase(std::random_device{}());
+        uint64_t now;
+
+        try
+        {
+            for (size_t index = 0; index < sessions; index++)
+            {
+                session user;
+                user.client = std::make_unique<netput::client>(address);
+                user.client->connect(reinterpret_cast<const uint8_t *>(profile.user_data.data()), profile.user_data.size());
+                user.client->set_send_mode(netput::send_mode::pipelined);
+                user.x = 0;
+                worker.sessions.push_back(std::move(user));
+                connected.fetch_add(1);
+            }
+        }
+        catch (...)
+        {
+            worker.error = std::current_exception();
+            connected.fetch_add(sessions - worker.sessions.size());
+            return;
+        }
+
+        while (start_ns.load() == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        // bursts and storms start at random points of their interval so the sessions do not all fire at once
+        for (session &user : worker.sessions)
+        {
+            user.next_motion_ns = start_ns.load();
+            user.next_typing_ns = start_ns.load() + ((profile.typing_interval_ms > 0) ? phase() % (profile.typing_interval_ms * 1000000) : 0);
+            user.next_resize_ns = start_ns.load() + ((profile.resize_interval_ms > 0) ? phase() % (profile.resize_interval_ms * 1000000) : 0);
+        }
+
+        try
+        {
+            now = bench::monotonic_ns();
+            while (now < end_ns.load())
+            {
+                for (session &user : worker.sessions)
+                {
+                    send_due(user, profile, now, worker.sent);
+                }
+                std::this_thread::sleep_for(std::chrono::microseconds(bench::load_tick_us));
+                now = bench::monotonic_ns();
+            }
+            for (session &user : worker.sessions)
+            {
+                user.client->disconnect();
+            }
+        }
+        catch (...)
+        {
+            worker.error = std::current_exception();
+        }
+        worker.sessions.clear();
+    }
+
+    void run_load(size_t sessions, const bench::load_profile &profile, const std::string &address, bench::server &target)
+    {
+        const size_t thread_count = std::max<size_t>(1, std::min<size_t>(bench::load_threads, std::thread::hardware_concurrency()));
+        std::vector<generator> generators(thread_count);
+        std::atomic<size_t> connected;
+        std::atomic<uint64_t> start_ns;
+        std::atomic<uint64_t> end_ns;
+        bench::histogram latency;
+        uint64_t connect_start;
+        uint64_t connect_ns;
+        uint64_t received;
+        uint64_t sent;
+        uint64_t elapsed;
+        size_t rss_before;
+        size_t rss_connected;
+        size_t rss_loaded;
+        size_t server_sessions;
+
+        connected.store(0);
+        start_ns.store(0);
+        end_ns.store(UINT64_MAX);
+        rss_before = resident_bytes();
+        connect_start = bench::monotonic_ns();
+        for (size_t index = 0; index < thread_count; index++)
+        {
+            const size_t share = sessions / thread_count + ((index < sessions % thread_count) ? 1 : 0);
+            generator *worker = &generators[index];
+            worker->sessions.reserve(share);
+            worker->thread = std::thread(
+                [&, worker, share]()
+                {
+                    run_generator(*worker, share, address, profile, connected, start_ns, end_ns);
+                });
+        }
+        bench::wait_until(
+            [&]()
+            {
+                return connected.load() == sessions;
+            },
+            std::chrono::seconds(600));
+        connect_ns = bench::monotonic_ns() - connect_start;
+        rss_connected = resident_bytes();
+        server_sessions = target.stats().sessions;
+
+        received = target.received();
+        target.record_latency(&latency);
+        end_ns.store(bench::monotonic_ns() + profile.seconds * 1000000000);
+        start_ns.store(bench::monotonic_ns());
+        sent = 0;
+        for (generator &worker : generators)
+        {
+            worker.thread.join();
+            sent += worker.sent;
+        }
+        for (generator &worker : generators)
+        {
+            if (worker.error)
+            {
+                target.record_latency(nullptr);
+                std::rethrow_exception(worker.error);
+            }
+        }
+        rss_loaded = resident_bytes();
+        // disconnect flushed every client, what is still missing is queued on the server
+        bench::wait_until(
+            [&]()
+            {
+                return target.received() - received >= sent;
+            },
+            std::chrono::seconds(60));
+        elapsed = bench::monotonic_ns() - start_ns.load();
+        target.record_latency(nullptr);
+
+        std::cout << "{\"benchmark\":\"load\""
+                  << ",\"sessions\":" << sessions
+                  << ",\"server_sessions\":" << server_sessions
+                  << ",\"threads\":" << thread_count
+                  << ",\"motion_hz\":" << profile.motion_hz
+                  << ",\"connects_per_second\":" << sessions / (connect_ns / 1e9)
+                  << ",\"events\":" << sent
+                  << ",\"offered_events_per_second\":" << sent / (profile.seconds > 0 ? static_cast<double>(profile.seconds) : 1.0)
+                  << ",\"server_events_per_second\":" << (target.received() - received) / (elapsed / 1e9)
+                  << ",\"p50_us\":" << latency.percentile(50.0) / 1e3
+                  << ",\"p90_us\":" << latency.percentile(90.0) / 1e3
+                  << ",\"p99_us\":" << latency.percentile(99.0) / 1e3
+                  << ",\"p99_9_us\":" << latency.percentile(99.9) / 1e3
+                  << ",\"max_us\":" << latency.max() / 1e3
+                  << ",\"process_rss_mb\":" << rss_loaded / 1048576.0
+                  << ",\"process_rss_kb_per_session\":" << (static_cast<double>(rss_connected) - rss_before) / 1024.0 / sessions
+                  << "}" << std::endl;
+    }
+}
+
+void bench::load(const std::vector<size_t> &session_counts, const load_profile &profile)
+{
+    raise_descriptor_limit();
+    // one server for the whole ladder; clients and server share the process, so the process_rss
+    // fields are what both sides hold together and not the server's footprint alone
+    server target(server_address(transport::tcp, bench::port));
+    const std::string address = client_address(transport::tcp, bench::port);
+
+    std::cout << std::fixed << std::setprecision(3);
+    for (size_t sessions : session_counts)
+    {
+        run_load(sessions, profile, address, target);
+    }
+}
@@ -0,0 +1,64 @@
+#include "bench.hpp"
+
+#include <sstream>
+
+int main(int argc, char **argv)
+{
+    int result;
+    std::string benchmark;
+    try
+    {
+        result = 0;
+        benchmark = (argc > 1) ? argv[1] : "throughput";
+        if (benchmark == "throughput")
+        {
+            bench::throughput((argc > 2) ? std::stoul(argv[2]) : bench::default_events);
+        }
+        else if (benchmark == "latency")
+        {
+            bench::latency(
+                (argc > 2) ? std::stoul(argv[2]) : bench::default_latency_events,
+                (argc > 3) ? std::stoul(argv[3]) : bench::default_latency_rate);
+        }
+        else if (benchmark == "recording")
+        {
+            bench::recording((argc > 2) ? std::stoul(argv[2]) : bench::default_events);
+        }
+        else if (benchmark == "load")
+        {
+            bench::load_profile profile = bench::default_load_profile;
+            std::vector<size_t> session_counts;
+            std::stringstream counts((argc > 2) ? argv[2] : "1000,2000,5000,10000");
+            std::string count;
+            while (std::getline(counts, count, ','))
+            {
+                session_counts.push_back(std::stoul(count));
+            }
+            profile.motion_hz = (argc > 3) ? std::stoul(argv[3]) : profile.motion_hz;
+            profile.seconds = (argc > 4) ? std::stoul(argv[4]) : profile.seconds;
+            profile.typing_burst = (argc > 5) ? std::stoul(argv[5]) : profile.typing_burst;
+            profile.resize_storm = (argc > 6) ? std::stoul(argv[6]) : profile.resize_storm;
+            profile.user_data = (argc > 7) ? argv[7] : profile.user_data;
+            bench::load(session_counts, profile);
+        }
+        else if (benchmark == "replay" && argc > 3)
+        {
+            bench::replay(
+                argv[2],
+                argv[3],
+                (argc > 4) ? argv[4] : "original",
+                (argc > 5) ? std::stod(argv[5]) : 1.0,
+                (argc > 6) ? std::stoull(argv[6]) : 1);
+        }
+        else
+        {
+            throw std::runtime_error("usage: netput_bench [throughput [events] | latency [events] [rate] | recording [events] | load [sessions,...] [motion_hz] [seconds] [typing_burst] [resize_storm] [user_data] | replay log address [original|scaled|maximum] [speed] [timestamp_ns]]");
+        }
+    }
+    catch (const std::exception &error)
+    {
+        result = 1;
+        std::cerr << error.what() << std::endl;
+    }
+    return result;
+}
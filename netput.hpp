@@ -1,14 +1,16 @@
 #ifndef _NETPUT_HPP_
 #define _NETPUT_HPP_
 
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 namespace netput
 {
-    enum input_state
+    enum input_state : uint8_t
     {
         released,
         pressed
@@ -32,6 +34,28 @@ namespace netput
         input_state x2;
     };
 
+    // bit 1 << mouse_button is set while that button is held, the form the mask takes on the wire
+    inline uint8_t button_bits(const mouse_button_state_mask &state_mask)
+    {
+        return static_cast<uint8_t>(
+            (state_mask.left << mouse_button::left) |
+            (state_mask.middle << mouse_button::middle) |
+            (state_mask.right << mouse_button::right) |
+            (state_mask.x1 << mouse_button::x1) |
+            (state_mask.x2 << mouse_button::x2));
+    }
+
+    inline mouse_button_state_mask button_state_mask(uint8_t bits)
+    {
+        mouse_button_state_mask result;
+        result.left = static_cast<input_state>((bits >> mouse_button::left) & 1);
+        result.middle = static_cast<input_state>((bits >> mouse_button::middle) & 1);
+        result.right = static_cast<input_state>((bits >> mouse_button::right) & 1);
+        result.x1 = static_cast<input_state>((bits >> mouse_button::x1) & 1);
+        result.x2 = static_cast<input_state>((bits >> mouse_button::x2) & 1);
+        return result;
+    }
+
     enum window_event
     {
         shown,
@@ -48,38 +72,279 @@ namespace netput
         focus_lost,
     };
 
+    enum io_mode
+    {
+        caller_thread,
+        background_thread
+    };
+
+    enum send_mode
+    {
+        blocking,
+        pipelined,
+        streaming
+    };
+
+    enum class event_type : uint8_t
+    {
+        keyboard,
+        mouse_motion,
+        mouse_button,
+        mouse_wheel,
+        window
+    };
+
+    const size_t event_type_count = 5;
+
+    // fixed-size copy of one input event, plain data so it can be queued and copied by value
+    struct event
+    {
+        event_type type;
+        // server-assigned session number, see server::session_id
+        uint32_t session;
+        uint64_t timestamp;
+        uint32_t window_id;
+        union
+        {
+            struct
+            {
+                input_state state;
+                bool repeat;
+                uint32_t key_code;
+            } keyboard;
+            struct
+            {
+                mouse_button_state_mask state_mask;
+                int32_t x;
+                int32_t y;
+                int32_t relative_x;
+                int32_t relative_y;
+            } mouse_motion;
+            struct
+            {
+                netput::mouse_button button;
+                input_state state;
+                bool double_click;
+                int32_t x;
+                int32_t y;
+            } mouse_button;
+            struct
+            {
+                int32_t x;
+                int32_t y;
+                float precise_x;
+                float precise_y;
+            } mouse_wheel;
+            struct
+            {
+                window_event type;
+                int32_t arg1;
+                int32_t arg2;
+            } window;
+        };
+    };
+
+    struct worker_stats
+    {
+        size_t queue_depth;
+        size_t max_queue_depth;
+        uint64_t events;
+        uint64_t handler_ns;
+    };
+
+    // send queue lanes of a background_thread client: discrete is keyboard, mouse button and window,
+    // continuous is mouse motion and wheel
+    enum class lane : uint8_t
+    {
+        discrete,
+        continuous
+    };
+
+    // time events of one lane spent queued before the io thread sent them
+    struct lane_stats
+    {
+        uint64_t events;
+        uint64_t total_wait_ns;
+        uint64_t max_wait_ns;
+    };
+
+    // when a client sends the events it holds back into one batch: at max_events events, at max_bytes
+    // encoded bytes or once the oldest has waited max_delay_us, 0 turning a limit off. adaptive caps
+    // the batch at about a quarter of the measured round trip's worth of events, so a fast link
+    // sends nearly every event alone and a slow one batches more. All off (the default) sends each
+    // event as it comes. Around 250 us suits remote play, 10000 us suits capture for analytics
+    struct flush_policy
+    {
+        size_t max_events;
+        size_t max_bytes;
+        uint64_t max_delay_us;
+        bool adaptive;
+    };
+
+    // running totals since construction, each field read on its own with a relaxed load so a
+    // snapshot taken while events flow is only roughly consistent across fields
+    struct client_stats
+    {
+        // events handed to the transport, indexed by event_type
+        uint64_t events[event_type_count];
+        // encoded rpc message and datagram bytes
+        uint64_t bytes;
+        uint64_t datagrams;
+        size_t in_flight;
+        // events waiting in a background_thread client's queues
+        size_t queue_depth;
+        uint64_t coalesced_events;
+    };
+
+    struct server_stats
+    {
+        // events received, indexed by event_type
+        uint64_t events[event_type_count];
+        // encoded rpc message and datagram bytes, event records for shared memory
+        uint64_t bytes;
+        size_t sessions;
+        // events waiting in the poll ring and the worker queues
+        size_t queue_depth;
+        uint64_t dropped_events;
+        uint64_t dropped_datagrams;
+        uint64_t recovered_datagrams;
+        // time spent in the handle_* callbacks, on the i/o thread and every worker
+        uint64_t handler_ns;
+    };
+
+    const size_t tracked_key_codes = 512;
+    const size_t tracked_windows = 8;
+
+    // a session's input as of the last event the server received from it
+    struct input_snapshot
+    {
+        // bit key_code % 64 of keys[key_code / 64] is set while the key is down, key codes from
+        // tracked_key_codes up are not tracked
+        uint64_t keys[tracked_key_codes / 64];
+        // bit 1 << mouse_button is set while the button is held
+        uint8_t buttons;
+        bool focused;
+        // the window that last gained focus, while focused
+        uint32_t focus_window_id;
+        // last cursor position from motion and button events in each window, the tracked_windows
+        // most recently moved in
+        size_t cursor_count;
+        struct
+        {
+            uint32_t window_id;
+            int32_t x;
+            int32_t y;
+        } cursors[tracked_windows];
+    };
+
     namespace internal
     {
         class client;
+        class client_thread;
+        class shm_client;
         class server;
+        class replay;
     }
 
     class client
     {
     public:
-        client(const std::string &host, uint16_t port);
+        client(const std::string &host, uint16_t port, io_mode mode = io_mode::caller_thread, size_t queue_capacity = 4096);
+        // address is "host:port", "unix:/path/to/socket" for a same-host unix domain socket, or
+        // "shm:/name" for the linux shared-memory ring of a server on the same host. Over shm a call
+        // that waits on the server throws once the server process is gone
+        client(const std::string &address, io_mode mode = io_mode::caller_thread, size_t queue_capacity = 4096);
         ~client() = default;
+        // in pipelined send mode connect() returns before the server answers and events queue behind
+        // it; a rejected or failed connect is thrown by the next flush() or disconnect()
         void connect(const uint8_t *buffer, size_t size);
         void disconnect();
         void send_keyboard(uint64_t timestamp, uint32_t window_id, input_state state, bool repeat, uint32_t key_code);
         void send_mouse_motion(uint64_t timestamp, uint32_t window_id, const mouse_button_state_mask &state_mask, int32_t x, int32_t y, int32_t relative_x, int32_t relative_y);
+        // buttons as from button_bits()
+        void send_mouse_motion(uint64_t timestamp, uint32_t window_id, uint8_t buttons, int32_t x, int32_t y, int32_t relative_x, int32_t relative_y);
         void send_mouse_button(uint64_t timestamp, uint32_t window_id, mouse_button button, input_state state, bool double_click, int32_t x, int32_t y);
         void send_mouse_wheel(uint64_t timestamp, uint32_t window_id, int32_t x, int32_t y);
         void send_mouse_wheel(uint64_t timestamp, uint32_t window_id, int32_t x, int32_t y, float precise_x, float precise_y);
         void send_window(uint64_t timestamp, uint32_t window_id, window_event type, int32_t arg1, int32_t arg2);
+        // same as the matching send_* call, record.session is ignored
+        void send(const event &record);
+        void begin_batch();
+        void send_batch();
+        void set_send_mode(send_mode mode, size_t max_in_flight = 256);
+        // begin_batch()/send_batch() and flush() still send at once. A background_thread client sends
+        // on the delay by itself; a caller_thread client only checks it on the next send or flush()
+        void set_flush_policy(const flush_policy &policy);
+        // a streaming client also waits for its stream here, and flush() or disconnect() throws when
+        // a streamed push failed
+        void flush();
+        void set_coalescing(bool enabled);
+        uint64_t coalesced_events() const;
+        // background_thread clients send queued discrete events ahead of queued motion and wheel,
+        // except that motion and wheel of the same window queued before a discrete event go first;
+        // all zero for the other modes, which have no queue
+        lane_stats get_lane_stats(lane which) const;
+        // all zero for shared memory clients
+        client_stats stats() const;
+        // asks the next connect() for the udp side channel of a tcp server: mouse motion and wheel
+        // then go out as unacknowledged datagrams while everything else stays on the stream. Lost
+        // datagrams are not resent and motion that would arrive out of order is dropped. A parity_group
+        // of k (at most 64, 0 for none) adds one xor parity datagram per k datagrams, from which the
+        // server rebuilds a single loss in the group; datagrams behind the loss wait for that parity
+        void set_udp(bool enabled, size_t parity_group = 0);
         void handle_error(const std::function<void(const std::string &)> &error_handler);
 
     private:
+        void invoke(const std::function<void(internal::client &)> &function);
+
         std::unique_ptr<internal::client, std::function<void(internal::client *)>> _client;
+        std::unique_ptr<internal::client_thread, std::function<void(internal::client_thread *)>> _client_thread;
+        std::unique_ptr<internal::shm_client, std::function<void(internal::shm_client *)>> _shm_client;
     };
 
     class server
     {
     public:
         server(const std::string &host, uint16_t port);
+        // address is "host:port", "unix:/path/to/socket" or "shm:/name"; a stale socket file or
+        // segment at the path is replaced, one a running server still uses is left alone and
+        // this server fails to start. A shared-memory server serves one client at a time
+        server(const std::string &address);
         ~server() = default;
         void serve();
+        // safe from any thread, once called serve() returns at once or as soon as it is called
         void shutdown();
+        // 0 (the default) runs handlers on the i/o thread, otherwise handlers run on count worker
+        // threads with each session pinned to one worker; call before serve()
+        void set_workers(size_t count);
+        std::vector<worker_stats> get_worker_stats() const;
+        // 0 (the default) delivers events to the handle_* callbacks, otherwise events are queued in a
+        // ring of capacity records for poll()/try_pop() from one consumer thread; call before serve()
+        void set_polling(size_t capacity);
+        size_t poll(event *events, size_t max);
+        bool try_pop(event &value);
+        // events lost because the poll ring was full
+        uint64_t dropped_events() const;
+        // offers clients that ask for it a udp side channel on the listening host; call before serve()
+        void set_udp(bool enabled);
+        // datagrams discarded as duplicate, stale, out of order, malformed or of an unknown channel
+        uint64_t dropped_datagrams() const;
+        // datagrams rebuilt from the parity of their group
+        uint64_t recovered_datagrams() const;
+        server_stats stats() const;
+        // appends every event received, with its session and receive time, and every session's
+        // connect and disconnect to a log of rpc::LogEntry messages at path ("" stops recording).
+        // Entries reach the file in groups about every 10 ms; call before serve()
+        void set_recording(const std::string &path);
+        // "" once the session has disconnected or dropped its connection, a closed session's
+        // number is never handed out again
+        std::string session_id(uint32_t session) const;
+        // keeps every session's held keys and buttons, cursor per window and focus, updated from
+        // each event before it reaches a handler, the poll ring or a worker; call before serve()
+        void set_input_tracking(bool enabled);
+        // false for an unknown or untracked session; safe from any thread, the read itself holds no
+        // lock so the i/o thread never waits on a reader
+        bool get_input_state(const std::string &session_id, input_snapshot &state) const;
         void handle_connect(const std::function<std::pair<bool, std::string>(const uint8_t *, size_t)> &connect_handler);
         void handle_disconnect(const std::function<bool(const std::string &)> &disconnect_handler);
         void handle_keyboard(const std::function<void(const std::string &, uint64_t, uint32_t, input_state, bool, uint32_t)> &keyboard_handler);
@@ -87,10 +352,67 @@ namespace netput
         void handle_mouse_button(const std::function<void(const std::string &, uint64_t, uint32_t, mouse_button, input_state, bool, int32_t, int32_t)> &mouse_button_handler);
         void handle_mouse_wheel(const std::function<void(const std::string &, uint64_t, uint32_t, int32_t, int32_t, float, float)> &mouse_wheel_handler);
         void handle_window(const std::function<void(const std::string &, uint64_t, uint32_t, window_event, int32_t, int32_t)> &window_handler);
+        // called before the per-type handlers, how often depends on the dispatch mode: on the i/o thread
+        // once per received push, batch, datagram or shared-memory read with all of its events; under
+        // set_workers once per event on the worker its session is pinned to; under set_polling never,
+        // neither are the per-type handlers. Resolve event::session with session_id()
+        void handle_events(const std::function<void(const event *, size_t)> &events_handler);
+        // failures the server carries on from: a handler that threw on a worker, a recording write,
+        // the udp side channel. Called from the serve() thread, a worker or the recorder thread, so
+        // the handler must be thread-safe when workers or recording are on; call before serve()
+        void handle_error(const std::function<void(const std::string &)> &error_handler);
 
     private:
         std::unique_ptr<internal::server, std::function<void(internal::server *)>> _server;
     };
+
+    enum class replay_mode : uint8_t
+    {
+        // the recorded spacing of events
+        original,
+        // the recorded spacing divided by replay_options::speed
+        scaled,
+        // every event as soon as the previous one is sent
+        maximum
+    };
+
+    struct replay_options
+    {
+        replay_mode mode;
+        // 10 plays ten times faster than recorded, replay_mode::scaled only; play() throws
+        // std::invalid_argument unless it is greater than zero
+        double speed;
+        // nanoseconds per unit of the recorded event timestamps, 1000000 for milliseconds; play()
+        // throws std::invalid_argument for 0 unless the mode is replay_mode::maximum
+        uint64_t timestamp_ns;
+    };
+
+    struct replay_stats
+    {
+        uint64_t sessions;
+        uint64_t events;
+        double seconds;
+        double events_per_second;
+        // how late entries were sent against the schedule, zero for replay_mode::maximum
+        uint64_t mean_error_ns;
+        uint64_t max_error_ns;
+    };
+
+    // a recording made with server::set_recording, loaded into memory. play() connects one
+    // pipelined caller_thread client per recorded session with its recorded user data and sends
+    // the log's entries in order: each session's events keep the spacing of their timestamps and
+    // connects and disconnects keep their receive times. Sessions recorded mid-stream connect with
+    // no data
+    class replay
+    {
+    public:
+        replay(const std::string &path);
+        ~replay() = default;
+        replay_stats play(const std::string &address, const replay_options &options);
+
+    private:
+        std::unique_ptr<internal::replay, std::function<void(internal::replay *)>> _replay;
+    };
 }
 
 #endif
\ No newline at end of file
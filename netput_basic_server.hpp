@@ -0,0 +1,465 @@
+#ifndef _NETPUT_BASIC_SERVER_HPP_
+#define _NETPUT_BASIC_SERVER_HPP_
+
+#include "netput.hpp"
+#include "src/netput.capnp.h"
+
+#include <capnp/ez-rpc.h>
+#include <kj/async.h>
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+namespace netput
+{
+    namespace internal
+    {
+        // true when Handler has a member function callable with the given arguments
+        template <typename Handler, typename = void>
+        struct has_on_connect : std::false_type
+        {
+        };
+        template <typename Handler>
+        struct has_on_connect<Handler, decltype(std::declval<Handler &>().on_connect(std::declval<const uint8_t *>(), size_t()), void())> : std::true_type
+        {
+        };
+
+        template <typename Handler, typename = void>
+        struct has_on_disconnect : std::false_type
+        {
+        };
+        template <typename Handler>
+        struct has_on_disconnect<Handler, decltype(std::declval<Handler &>().on_disconnect(std::declval<const std::string &>()), void())> : std::true_type
+        {
+        };
+
+        template <typename Handler, typename = void>
+        struct has_on_keyboard : std::false_type
+        {
+        };
+        template <typename Handler>
+        struct has_on_keyboard<Handler, decltype(std::declval<Handler &>().on_keyboard(std::declval<const std::string &>(), uint64_t(), uint32_t(), input_state(), bool(), uint32_t()), void())> : std::true_type
+        {
+        };
+
+        template <typename Handler, typename = void>
+        struct has_on_mouse_motion : std::false_type
+        {
+        };
+        template <typename Handler>
+        struct has_on_mouse_motion<Handler, decltype(std::declval<Handler &>().on_mouse_motion(std::declval<const std::string &>(), uint64_t(), uint32_t(), std::declval<const mouse_button_state_mask &>(), int32_t(), int32_t(), int32_t(), int32_t()), void())> : std::true_type
+        {
+        };
+
+        template <typename Handler, typename = void>
+        struct has_on_mouse_button : std::false_type
+        {
+        };
+        template <typename Handler>
+        struct has_on_mouse_button<Handler, decltype(std::declval<Handler &>().on_mouse_button(std::declval<const std::string &>(), uint64_t(), uint32_t(), mouse_button(), input_state(), bool(), int32_t(), int32_t()), void())> : std::true_type
+        {
+        };
+
+        template <typename Handler, typename = void>
+        struct has_on_mouse_wheel : std::false_type
+        {
+        };
+        template <typename Handler>
+        struct has_on_mouse_wheel<Handler, decltype(std::declval<Handler &>().on_mouse_wheel(std::declval<const std::string &>(), uint64_t(), uint32_t(), int32_t(), int32_t(), float(), float()), void())> : std::true_type
+        {
+        };
+
+        template <typename Handler, typename = void>
+        struct has_on_window : std::false_type
+        {
+        };
+        template <typename Handler>
+        struct has_on_window<Handler, decltype(std::declval<Handler &>().on_window(std::declval<const std::string &>(), uint64_t(), uint32_t(), window_event(), int32_t(), int32_t()), void())> : std::true_type
+        {
+        };
+
+        inline input_state basic_input_state(rpc::InputState state)
+        {
+            return (state == rpc::InputState::PRESSED) ? input_state::pressed : input_state::released;
+        }
+
+        // the rpc enums are declared in the same order as the public ones, callers drop enumerants
+        // past the last public one
+        inline mouse_button basic_mouse_button(rpc::MouseButton button)
+        {
+            return static_cast<mouse_button>(static_cast<uint16_t>(button));
+        }
+
+        inline window_event basic_window_event(rpc::WindowEventType type)
+        {
+            return static_cast<window_event>(static_cast<uint16_t>(type));
+        }
+
+        // true when the first of Arguments converts to a port, such a call means host and port
+        template <typename... Arguments>
+        struct leads_with_port : std::false_type
+        {
+        };
+        template <typename First, typename... Rest>
+        struct leads_with_port<First, Rest...> : std::is_convertible<First, uint16_t>
+        {
+        };
+
+        // decodes rpc events into calls of Handler's on_* members, basic_server runs every event it
+        // receives through one
+        template <typename Handler>
+        class basic_dispatcher
+        {
+        public:
+            // arguments are forwarded to Handler's constructor, the handler is built in place
+            template <typename... Arguments>
+            basic_dispatcher(Arguments &&...arguments) : _handler(std::forward<Arguments>(arguments)...)
+            {
+            }
+
+            Handler &handler()
+            {
+                return _handler;
+            }
+
+            // decodes one event and hands it to the matching on_* member
+            void dispatch(const std::string &session_id, const rpc::Event::Info::Reader &info)
+            {
+                switch (info.which())
+                {
+                case rpc::Event::Info::KEYBOARD:
+                    dispatch_keyboard(session_id, info, has_on_keyboard<Handler>());
+                    break;
+                case rpc::Event::Info::MOUSE_MOTION:
+                    dispatch_mouse_motion(session_id, info, has_on_mouse_motion<Handler>());
+                    break;
+                case rpc::Event::Info::MOUSE_BUTTON:
+                    dispatch_mouse_button(session_id, info, has_on_mouse_button<Handler>());
+                    break;
+                case rpc::Event::Info::MOUSE_WHEEL:
+                    dispatch_mouse_wheel(session_id, info, has_on_mouse_wheel<Handler>());
+                    break;
+                case rpc::Event::Info::WINDOW:
+                    dispatch_window(session_id, info, has_on_window<Handler>());
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            void dispatch(const std::string &session_id, const capnp::List<rpc::Event>::Reader &events)
+            {
+                for (const rpc::Event::Reader event : events)
+                {
+                    dispatch(session_id, event.getInfo());
+                }
+            }
+
+        private:
+            void dispatch_keyboard(const std::string &session_id, const rpc::Event::Info::Reader &info, std::true_type)
+            {
+                const rpc::KeyboardEvent::Reader reader = info.getKeyboard();
+                _handler.on_keyboard(
+                    session_id,
+                    reader.getTimestamp(),
+                    reader.getWindowId(),
+                    basic_input_state(reader.getState()),
+                    reader.getRepeat(),
+                    reader.getKeyCode());
+            }
+
+            void dispatch_keyboard(const std::string &, const rpc::Event::Info::Reader &, std::false_type)
+            {
+            }
+
+            void dispatch_mouse_motion(const std::string &session_id, const rpc::Event::Info::Reader &info, std::true_type)
+            {
+                const rpc::MouseMotionEvent::Reader reader = info.getMouseMotion();
+                mouse_button_state_mask state_mask;
+                // only older clients send the nested mask
+                if (reader.hasStateMask())
+                {
+                    const rpc::MouseMotionEvent::MouseStateMask::Reader state_mask_reader = reader.getStateMask();
+                    state_mask.left = basic_input_state(state_mask_reader.getLeft());
+                    state_mask.middle = basic_input_state(state_mask_reader.getMiddle());
+                    state_mask.right = basic_input_state(state_mask_reader.getRight());
+                    state_mask.x1 = basic_input_state(state_mask_reader.getX1());
+                    state_mask.x2 = basic_input_state(state_mask_reader.getX2());
+                }
+                else
+                {
+                    state_mask = button_state_mask(reader.getButtons());
+                }
+                _handler.on_mouse_motion(
+                    session_id,
+                    reader.getTimestamp(),
+                    reader.getWindowId(),
+                    state_mask,
+                    reader.getX(),
+                    reader.getY(),
+                    reader.getRelativeX(),
+                    reader.getRelativeY());
+            }
+
+            void dispatch_mouse_motion(const std::string &, const rpc::Event::Info::Reader &, std::false_type)
+            {
+            }
+
+            void dispatch_mouse_button(const std::string &session_id, const rpc::Event::Info::Reader &info, std::true_type)
+            {
+                const rpc::MouseButtonEvent::Reader reader = info.getMouseButton();
+                // an enumerant added by a newer client has no mouse_button to map to
+                if (reader.getButton() > rpc::MouseButton::X2)
+                {
+                    return;
+                }
+                _handler.on_mouse_button(
+                    session_id,
+                    reader.getTimestamp(),
+                    reader.getWindowId(),
+                    basic_mouse_button(reader.getButton()),
+                    basic_input_state(reader.getState()),
+                    reader.getDouble(),
+                    reader.getX(),
+                    reader.getY());
+            }
+
+            void dispatch_mouse_button(const std::string &, const rpc::Event::Info::Reader &, std::false_type)
+            {
+            }
+
+            void dispatch_mouse_wheel(const std::string &session_id, const rpc::Event::Info::Reader &info, std::true_type)
+            {
+                const rpc::MouseWheelEvent::Reader reader = info.getMouseWheel();
+                _handler.on_mouse_wheel(
+                    session_id,
+                    reader.getTimestamp(),
+                    reader.getWindowId(),
+                    reader.getX(),
+                    reader.getY(),
+                    reader.getPreciseX(),
+                    reader.getPreciseY());
+            }
+
+            void dispatch_mouse_wheel(const std::string &, const rpc::Event::Info::Reader &, std::false_type)
+            {
+            }
+
+            void dispatch_window(const std::string &session_id, const rpc::Event::Info::Reader &info, std::true_type)
+            {
+                const rpc::WindowEvent::Reader reader = info.getWindow();
+                if (reader.getType() > rpc::WindowEventType::FOCUS_LOST_TYPE)
+                {
+                    return;
+                }
+                _handler.on_window(
+                    session_id,
+                    reader.getTimestamp(),
+                    reader.getWindowId(),
+                    basic_window_event(reader.getType()),
+                    reader.getArg1(),
+                    reader.getArg2());
+            }
+
+            void dispatch_window(const std::string &, const rpc::Event::Info::Reader &, std::false_type)
+            {
+            }
+
+            Handler _handler;
+        };
+    }
+
+    // header-only server that calls Handler's on_* members directly instead of through
+    // std::function, so they can be inlined; an on_* the handler does not declare costs
+    // nothing, not even the decoding of its fields. Every member is optional:
+    //   std::pair<bool, std::string> on_connect(const uint8_t *buffer, size_t size);
+    //   bool on_disconnect(const std::string &session_id);
+    //   void on_keyboard(const std::string &session_id, uint64_t timestamp, uint32_t window_id, input_state state, bool repeat, uint32_t key_code);
+    //   void on_mouse_motion(const std::string &session_id, uint64_t timestamp, uint32_t window_id, const mouse_button_state_mask &state_mask, int32_t x, int32_t y, int32_t relative_x, int32_t relative_y);
+    //   void on_mouse_button(const std::string &session_id, uint64_t timestamp, uint32_t window_id, mouse_button button, input_state state, bool double_click, int32_t x, int32_t y);
+    //   void on_mouse_wheel(const std::string &session_id, uint64_t timestamp, uint32_t window_id, int32_t x, int32_t y, float precise_x, float precise_y);
+    //   void on_window(const std::string &session_id, uint64_t timestamp, uint32_t window_id, window_event type, int32_t arg1, int32_t arg2);
+    // Handlers run on the thread that calls serve().
+    template <typename Handler>
+    class basic_server
+    {
+    public:
+        // arguments are forwarded to Handler's constructor, the handler is built in place
+        template <typename... Arguments>
+        basic_server(const std::string &host, uint16_t port, Arguments &&...arguments) : _dispatcher(std::forward<Arguments>(arguments)...)
+        {
+            listen(host + ":" + std::to_string(port));
+        }
+
+        // address is "host:port" or "unix:/path/to/socket", unlike netput::server a stale socket
+        // file at the path is not replaced; a first argument that converts to a port means the
+        // constructor above
+        template <typename... Arguments, typename = typename std::enable_if<!internal::leads_with_port<Arguments...>::value>::type>
+        basic_server(const std::string &address, Arguments &&...arguments) : _dispatcher(std::forward<Arguments>(arguments)...)
+        {
+            listen(address);
+        }
+
+        void serve()
+        {
+            kj::WaitScope &wait_scope = _rpc_server->getWaitScope();
+            _promise_fulfiller->promise.wait(wait_scope);
+            _rpc_server = nullptr;
+        }
+
+        // safe from any thread, once called serve() returns at once or as soon as it is called
+        void shutdown()
+        {
+            _promise_fulfiller->fulfiller->fulfill();
+        }
+
+        Handler &handler()
+        {
+            return _dispatcher.handler();
+        }
+
+    private:
+        class session final : public rpc::Session::Server
+        {
+        public:
+            session(basic_server &server, const std::string &session_id) : _server(server), _session_id(session_id)
+            {
+            }
+
+            kj::Promise<void> push(rpc::Session::Server::PushContext context) override
+            {
+                _server._dispatcher.dispatch(_session_id, context.getParams().getEvent().getInfo());
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> pushBatch(rpc::Session::Server::PushBatchContext context) override
+            {
+                _server._dispatcher.dispatch(_session_id, context.getParams().getEvents());
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> pushStream(rpc::Session::Server::PushStreamContext context) override
+            {
+                _server._dispatcher.dispatch(_session_id, context.getParams().getEvent().getInfo());
+                return kj::READY_NOW;
+            }
+
+        private:
+            basic_server &_server;
+            const std::string _session_id;
+        };
+
+        class service final : public rpc::Netput::Server
+        {
+        public:
+            service(basic_server &server) : _server(server)
+            {
+            }
+
+            kj::Promise<void> connect(rpc::Netput::Server::ConnectContext context) override
+            {
+                const rpc::ConnectRequest::Reader reader = context.getParams().getRequest();
+                rpc::ConnectResponse::Builder builder = context.getResults().initResponse();
+                const capnp::Data::Reader user_data = reader.getUserData();
+                const std::pair<bool, std::string> result = _server.connect(
+                    reader.hasUserData() ? user_data.begin() : nullptr,
+                    reader.hasUserData() ? user_data.size() : 0,
+                    internal::has_on_connect<Handler>());
+                if (result.first)
+                {
+                    builder.initMessage().setSessionId(result.second);
+                    builder.setSession(kj::heap<session>(_server, result.second));
+                }
+                else
+                {
+                    builder.initMessage().setError(result.second);
+                }
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> push(rpc::Netput::Server::PushContext context) override
+            {
+                const rpc::Event::Reader reader = context.getParams().getEvent();
+                _server._dispatcher.dispatch(session_id(reader.getSessionId()), reader.getInfo());
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> disconnect(rpc::Netput::Server::DisconnectContext context) override
+            {
+                const rpc::DisconnectRequest::Reader reader = context.getParams().getRequest();
+                rpc::DisconnectResponse::Builder builder = context.getResults().initResponse();
+                if (!reader.hasSessionId() || !_server.disconnect(reader.getSessionId(), internal::has_on_disconnect<Handler>()))
+                {
+                    builder.setError("disconnect failed");
+                }
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> pushStream(rpc::Netput::Server::PushStreamContext context) override
+            {
+                const rpc::Event::Reader reader = context.getParams().getEvent();
+                _server._dispatcher.dispatch(session_id(reader.getSessionId()), reader.getInfo());
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> pushBatch(rpc::Netput::Server::PushBatchContext context) override
+            {
+                const rpc::EventBatch::Reader reader = context.getParams().getBatch();
+                _server._dispatcher.dispatch(session_id(reader.getSessionId()), reader.getEvents());
+                return kj::READY_NOW;
+            }
+
+        private:
+            // the legacy methods name the session in every message, the last one is kept so a
+            // session that keeps pushing is not copied into a new string each time
+            const std::string &session_id(const capnp::Text::Reader &text)
+            {
+                if (_session_id.size() != text.size() ||
+                    std::memcmp(_session_id.data(), text.begin(), text.size()) != 0)
+                {
+                    _session_id.assign(text.begin(), text.size());
+                }
+                return _session_id;
+            }
+
+            basic_server &_server;
+            std::string _session_id;
+        };
+
+        void listen(const std::string &address)
+        {
+            _rpc_server = kj::heap<capnp::EzRpcServer>(kj::heap<service>(*this), address);
+            // made here so a shutdown() before serve() is not lost
+            _promise_fulfiller = kj::heap<kj::PromiseCrossThreadFulfillerPair<void>>(
+                kj::newPromiseAndCrossThreadFulfiller<void>());
+        }
+
+        std::pair<bool, std::string> connect(const uint8_t *buffer, size_t size, std::true_type)
+        {
+            return handler().on_connect(buffer, size);
+        }
+
+        std::pair<bool, std::string> connect(const uint8_t *, size_t, std::false_type)
+        {
+            return std::make_pair(false, std::string("unimplemented connection handler"));
+        }
+
+        bool disconnect(const std::string &session_id, std::true_type)
+        {
+            return handler().on_disconnect(session_id);
+        }
+
+        bool disconnect(const std::string &, std::false_type)
+        {
+            return true;
+        }
+
+        internal::basic_dispatcher<Handler> _dispatcher;
+        kj::Own<capnp::EzRpcServer> _rpc_server;
+        kj::Own<kj::PromiseCrossThreadFulfillerPair<void>> _promise_fulfiller;
+    };
+}
+
+#endif
@@ -5,7 +5,7 @@
 
 namespace capnp {
 namespace schemas {
-static const ::capnp::_::AlignedData<49> b_fa4a1bc90f7e051b = {
+static const ::capnp::_::AlignedData<71> b_fa4a1bc90f7e051b = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
      27,   5, 126,  15, 201,  27,  74, 250,
      13,   0,   0,   0,   3,   0,   0,   0,
@@ -15,38 +15,54 @@ static const ::capnp::_::AlignedData<49> b_fa4a1bc90f7e051b = {
      21,   0,   0,   0, 162,   0,   0,   0,
      29,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     25,   0,   0,   0, 199,   0,   0,   0,
-    149,   0,   0,   0,   7,   0,   0,   0,
+     25,   0,   0,   0,  71,   1,   0,   0,
+    237,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     110, 101, 116, 112, 117, 116,  46,  99,
      97, 112, 110, 112,  58,  78, 101, 116,
     112, 117, 116,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   1,   0,   1,   0,
-     12,   0,   0,   0,   3,   0,   5,   0,
+     20,   0,   0,   0,   3,   0,   5,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     172, 153, 217, 123,  77, 228, 235, 175,
      32,  49, 171,  13, 178, 138, 226, 205,
-     81,   0,   0,   0,  66,   0,   0,   0,
+    145,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     69,   0,   0,   0,   7,   0,   0,   0,
+    133,   0,   0,   0,   7,   0,   0,   0,
       1,   0,   0,   0,   0,   0,   0,   0,
       9, 162, 235, 121,  59,  28, 224, 176,
     165, 241,   0, 245,  64, 157, 221, 184,
-     57,   0,   0,   0,  42,   0,   0,   0,
+    121,   0,   0,   0,  42,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     45,   0,   0,   0,   7,   0,   0,   0,
+    109,   0,   0,   0,   7,   0,   0,   0,
       2,   0,   0,   0,   0,   0,   0,   0,
      30, 215,  99,  97,  65,  62,   5, 145,
     167,  25,  96, 102, 114, 249, 196, 241,
-     33,   0,   0,   0,  90,   0,   0,   0,
+     97,   0,   0,   0,  90,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     89,   0,   0,   0,   7,   0,   0,   0,
+      3,   0,   0,   0,   0,   0,   0,   0,
+    149, 229,  90,  63,  18, 133, 171, 186,
+     19, 140, 213, 213,  95, 160,  78, 197,
+     77,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     69,   0,   0,   0,   7,   0,   0,   0,
+      4,   0,   0,   0,   0,   0,   0,   0,
+     80, 133, 240,  70,  17,  90,  85, 140,
+    110, 177, 192, 119,  51, 154,  95, 153,
+     57,   0,   0,   0,  90,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     25,   0,   0,   0,   7,   0,   0,   0,
+     49,   0,   0,   0,   7,   0,   0,   0,
      99, 111, 110, 110, 101,  99, 116,   0,
       0,   0,   0,   0,   0,   0,   1,   0,
     112, 117, 115, 104,   0,   0,   0,   0,
@@ -54,22 +70,32 @@ static const ::capnp::_::AlignedData<49> b_fa4a1bc90f7e051b = {
     100, 105, 115,  99, 111, 110, 110, 101,
      99, 116,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   1,   0,
+    112, 117, 115, 104,  66,  97, 116,  99,
+    104,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
+    112, 117, 115, 104,  83, 116, 114, 101,
+     97, 109,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
       0,   0,   0,   0,   1,   0,   1,   0, }
 };
 ::capnp::word const* const bp_fa4a1bc90f7e051b = b_fa4a1bc90f7e051b.words;
 #if !CAPNP_LITE
 static const ::capnp::_::RawSchema* const d_fa4a1bc90f7e051b[] = {
+  &s_8c555a1146f08550,
   &s_91053e416163d71e,
+  &s_995f9a3377c0b16e,
   &s_afebe44d7bd999ac,
   &s_b0e01c3b79eba209,
   &s_b8dd9d40f500f1a5,
+  &s_baab85123f5ae595,
+  &s_c54ea05fd5d58c13,
   &s_cde28ab20dab3120,
   &s_f1c4f972666019a7,
 };
-static const uint16_t m_fa4a1bc90f7e051b[] = {0, 2, 1};
+static const uint16_t m_fa4a1bc90f7e051b[] = {0, 2, 1, 3, 4};
 const ::capnp::_::RawSchema s_fa4a1bc90f7e051b = {
-  0xfa4a1bc90f7e051b, b_fa4a1bc90f7e051b.words, 49, d_fa4a1bc90f7e051b, m_fa4a1bc90f7e051b,
-  6, 3, nullptr, nullptr, nullptr, { &s_fa4a1bc90f7e051b, nullptr, nullptr, 0, 0, nullptr }, false
+  0xfa4a1bc90f7e051b, b_fa4a1bc90f7e051b.words, 71, d_fa4a1bc90f7e051b, m_fa4a1bc90f7e051b,
+  10, 5, nullptr, nullptr, nullptr, { &s_fa4a1bc90f7e051b, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
 static const ::capnp::_::AlignedData<33> b_afebe44d7bd999ac = {
@@ -334,217 +360,212 @@ const ::capnp::_::RawSchema s_f1c4f972666019a7 = {
   1, 1, i_f1c4f972666019a7, nullptr, nullptr, { &s_f1c4f972666019a7, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_b2ed5d8c33a99cfc = {
+static const ::capnp::_::AlignedData<33> b_baab85123f5ae595 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    252, 156, 169,  51, 140,  93, 237, 178,
-     13,   0,   0,   0,   1,   0,   0,   0,
-     79, 101,  81, 227, 209, 112, 242, 149,
+    149, 229,  90,  63,  18, 133, 171, 186,
+     20,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
       1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 226,   0,   0,   0,
-     33,   0,   0,   0,   7,   0,   0,   0,
+     21,   0,   0,   0,  42,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      29,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     110, 101, 116, 112, 117, 116,  46,  99,
-     97, 112, 110, 112,  58,  67, 111, 110,
-    110, 101,  99, 116,  82, 101, 113, 117,
-    101, 115, 116,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   1,   0,   1,   0,
+     97, 112, 110, 112,  58,  78, 101, 116,
+    112, 117, 116,  46, 112, 117, 115, 104,
+     66,  97, 116,  99, 104,  36,  80,  97,
+    114,  97, 109, 115,   0,   0,   0,   0,
       4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   3,   0,   1,   0,
-     24,   0,   0,   0,   2,   0,   1,   0,
-    117, 115, 101, 114,  68,  97, 116,  97,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  50,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+     98,  97, 116,  99, 104,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    211, 216,  79, 239, 111, 179, 123, 141,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_b2ed5d8c33a99cfc = b_b2ed5d8c33a99cfc.words;
+::capnp::word const* const bp_baab85123f5ae595 = b_baab85123f5ae595.words;
 #if !CAPNP_LITE
-static const uint16_t m_b2ed5d8c33a99cfc[] = {0};
-static const uint16_t i_b2ed5d8c33a99cfc[] = {0};
-const ::capnp::_::RawSchema s_b2ed5d8c33a99cfc = {
-  0xb2ed5d8c33a99cfc, b_b2ed5d8c33a99cfc.words, 34, nullptr, m_b2ed5d8c33a99cfc,
-  0, 1, i_b2ed5d8c33a99cfc, nullptr, nullptr, { &s_b2ed5d8c33a99cfc, nullptr, nullptr, 0, 0, nullptr }, false
+static const ::capnp::_::RawSchema* const d_baab85123f5ae595[] = {
+  &s_8d7bb36fef4fd8d3,
+};
+static const uint16_t m_baab85123f5ae595[] = {0};
+static const uint16_t i_baab85123f5ae595[] = {0};
+const ::capnp::_::RawSchema s_baab85123f5ae595 = {
+  0xbaab85123f5ae595, b_baab85123f5ae595.words, 33, d_baab85123f5ae595, m_baab85123f5ae595,
+  1, 1, i_baab85123f5ae595, nullptr, nullptr, { &s_baab85123f5ae595, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<26> b_e8db608ad47956cb = {
+static const ::capnp::_::AlignedData<17> b_c54ea05fd5d58c13 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    203,  86, 121, 212, 138,  96, 219, 232,
-     13,   0,   0,   0,   1,   0,   1,   0,
-     79, 101,  81, 227, 209, 112, 242, 149,
-      1,   0,   7,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 234,   0,   0,   0,
-     33,   0,   0,   0,   7,   0,   0,   0,
+     19, 140, 213, 213,  95, 160,  78, 197,
+     20,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     29,   0,   0,   0,  63,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  50,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    110, 101, 116, 112, 117, 116,  46,  99,
-     97, 112, 110, 112,  58,  67, 111, 110,
-    110, 101,  99, 116,  82, 101, 115, 112,
-    111, 110, 115, 101,   0,   0,   0,   0,
-      0,   0,   0,   0,   1,   0,   1,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-     51, 218,  75,  68,  98, 253, 150, 186,
-     13,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    109, 101, 115, 115,  97, 103, 101,   0, }
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  78, 101, 116,
+    112, 117, 116,  46, 112, 117, 115, 104,
+     66,  97, 116,  99, 104,  36,  82, 101,
+    115, 117, 108, 116, 115,   0,   0,   0, }
 };
-::capnp::word const* const bp_e8db608ad47956cb = b_e8db608ad47956cb.words;
+::capnp::word const* const bp_c54ea05fd5d58c13 = b_c54ea05fd5d58c13.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_e8db608ad47956cb[] = {
-  &s_ba96fd62444bda33,
-};
-static const uint16_t m_e8db608ad47956cb[] = {0};
-static const uint16_t i_e8db608ad47956cb[] = {0};
-const ::capnp::_::RawSchema s_e8db608ad47956cb = {
-  0xe8db608ad47956cb, b_e8db608ad47956cb.words, 26, d_e8db608ad47956cb, m_e8db608ad47956cb,
-  1, 1, i_e8db608ad47956cb, nullptr, nullptr, { &s_e8db608ad47956cb, nullptr, nullptr, 0, 0, nullptr }, false
+const ::capnp::_::RawSchema s_c54ea05fd5d58c13 = {
+  0xc54ea05fd5d58c13, b_c54ea05fd5d58c13.words, 17, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_c54ea05fd5d58c13, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<49> b_ba96fd62444bda33 = {
+static const ::capnp::_::AlignedData<33> b_8c555a1146f08550 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     51, 218,  75,  68,  98, 253, 150, 186,
-     29,   0,   0,   0,   1,   0,   1,   0,
-    203,  86, 121, 212, 138,  96, 219, 232,
-      1,   0,   7,   0,   1,   0,   2,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  42,   1,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     29,   0,   0,   0, 119,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    110, 101, 116, 112, 117, 116,  46,  99,
-     97, 112, 110, 112,  58,  67, 111, 110,
-    110, 101,  99, 116,  82, 101, 115, 112,
-    111, 110, 115, 101,  46, 109, 101, 115,
-    115,  97, 103, 101,   0,   0,   0,   0,
-      8,   0,   0,   0,   3,   0,   4,   0,
-      0,   0, 255, 255,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     41,   0,   0,   0,  82,   0,   0,   0,
+     80, 133, 240,  70,  17,  90,  85, 140,
+     20,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     40,   0,   0,   0,   3,   0,   1,   0,
-     52,   0,   0,   0,   2,   0,   1,   0,
-      1,   0, 254, 255,   0,   0,   0,   0,
-      0,   0,   1,   0,   1,   0,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     49,   0,   0,   0,  50,   0,   0,   0,
+     21,   0,   0,   0,  50,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     44,   0,   0,   0,   3,   0,   1,   0,
-     56,   0,   0,   0,   2,   0,   1,   0,
-    115, 101, 115, 115, 105, 111, 110,  73,
-    100,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  78, 101, 116,
+    112, 117, 116,  46, 112, 117, 115, 104,
+     83, 116, 114, 101,  97, 109,  36,  80,
+     97, 114,  97, 109, 115,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    101, 114, 114, 111, 114,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  50,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    101, 118, 101, 110, 116,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     27, 162, 196,  21,   0,  63,  71, 240,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_ba96fd62444bda33 = b_ba96fd62444bda33.words;
+::capnp::word const* const bp_8c555a1146f08550 = b_8c555a1146f08550.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_ba96fd62444bda33[] = {
-  &s_e8db608ad47956cb,
+static const ::capnp::_::RawSchema* const d_8c555a1146f08550[] = {
+  &s_f0473f0015c4a21b,
 };
-static const uint16_t m_ba96fd62444bda33[] = {1, 0};
-static const uint16_t i_ba96fd62444bda33[] = {0, 1};
-const ::capnp::_::RawSchema s_ba96fd62444bda33 = {
-  0xba96fd62444bda33, b_ba96fd62444bda33.words, 49, d_ba96fd62444bda33, m_ba96fd62444bda33,
-  1, 2, i_ba96fd62444bda33, nullptr, nullptr, { &s_ba96fd62444bda33, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_8c555a1146f08550[] = {0};
+static const uint16_t i_8c555a1146f08550[] = {0};
+const ::capnp::_::RawSchema s_8c555a1146f08550 = {
+  0x8c555a1146f08550, b_8c555a1146f08550.words, 33, d_8c555a1146f08550, m_8c555a1146f08550,
+  1, 1, i_8c555a1146f08550, nullptr, nullptr, { &s_8c555a1146f08550, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<34> b_a542553ee6cb6157 = {
+static const ::capnp::_::AlignedData<50> b_f378c74259fc8918 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     87,  97, 203, 230,  62,  85,  66, 165,
-     13,   0,   0,   0,   1,   0,   0,   0,
+     24, 137, 252,  89,  66, 199, 120, 243,
+     13,   0,   0,   0,   3,   0,   0,   0,
      79, 101,  81, 227, 209, 112, 242, 149,
-      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 250,   0,   0,   0,
-     33,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     29,   0,   0,   0,  63,   0,   0,   0,
+     21,   0,   0,   0, 170,   0,   0,   0,
+     29,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     25,   0,   0,   0, 199,   0,   0,   0,
+    153,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     110, 101, 116, 112, 117, 116,  46,  99,
-     97, 112, 110, 112,  58,  68, 105, 115,
-     99, 111, 110, 110, 101,  99, 116,  82,
-    101, 113, 117, 101, 115, 116,   0,   0,
+     97, 112, 110, 112,  58,  83, 101, 115,
+    115, 105, 111, 110,   0,   0,   0,   0,
       0,   0,   0,   0,   1,   0,   1,   0,
-      4,   0,   0,   0,   3,   0,   4,   0,
+     12,   0,   0,   0,   3,   0,   5,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
+    215,  93,  94, 163,  26, 194, 163, 224,
+     58, 177,  40, 181, 225, 249, 181, 254,
+     81,   0,   0,   0,  42,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     13,   0,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   3,   0,   1,   0,
-     24,   0,   0,   0,   2,   0,   1,   0,
-    115, 101, 115, 115, 105, 111, 110,  73,
-    100,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     69,   0,   0,   0,   7,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+    174, 123, 208, 218, 231, 164,  46, 195,
+    132, 113, 147,  63, 240,  88, 155, 145,
+     57,   0,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0, }
+     49,   0,   0,   0,   7,   0,   0,   0,
+      2,   0,   0,   0,   0,   0,   0,   0,
+     44,  41, 241, 174, 168, 123,  60, 187,
+    110, 177, 192, 119,  51, 154,  95, 153,
+     37,   0,   0,   0,  90,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0,   7,   0,   0,   0,
+    112, 117, 115, 104,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
+    112, 117, 115, 104,  66,  97, 116,  99,
+    104,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
+    112, 117, 115, 104,  83, 116, 114, 101,
+     97, 109,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   1,   0,
+      0,   0,   0,   0,   1,   0,   1,   0, }
 };
-::capnp::word const* const bp_a542553ee6cb6157 = b_a542553ee6cb6157.words;
+::capnp::word const* const bp_f378c74259fc8918 = b_f378c74259fc8918.words;
 #if !CAPNP_LITE
-static const uint16_t m_a542553ee6cb6157[] = {0};
-static const uint16_t i_a542553ee6cb6157[] = {0};
-const ::capnp::_::RawSchema s_a542553ee6cb6157 = {
-  0xa542553ee6cb6157, b_a542553ee6cb6157.words, 34, nullptr, m_a542553ee6cb6157,
-  0, 1, i_a542553ee6cb6157, nullptr, nullptr, { &s_a542553ee6cb6157, nullptr, nullptr, 0, 0, nullptr }, false
+static const ::capnp::_::RawSchema* const d_f378c74259fc8918[] = {
+  &s_919b58f03f937184,
+  &s_995f9a3377c0b16e,
+  &s_bb3c7ba8aef1292c,
+  &s_c32ea4e7dad07bae,
+  &s_e0a3c21aa35e5dd7,
+  &s_feb5f9e1b528b13a,
+};
+static const uint16_t m_f378c74259fc8918[] = {0, 1, 2};
+const ::capnp::_::RawSchema s_f378c74259fc8918 = {
+  0xf378c74259fc8918, b_f378c74259fc8918.words, 50, d_f378c74259fc8918, m_f378c74259fc8918,
+  6, 3, nullptr, nullptr, nullptr, { &s_f378c74259fc8918, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<33> b_977d693f820bb9cd = {
+static const ::capnp::_::AlignedData<33> b_e0a3c21aa35e5dd7 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    205, 185,  11, 130,  63, 105, 125, 151,
-     13,   0,   0,   0,   1,   0,   0,   0,
-     79, 101,  81, 227, 209, 112, 242, 149,
+    215,  93,  94, 163,  26, 194, 163, 224,
+     21,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
       1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,   2,   1,   0,   0,
-     33,   0,   0,   0,   7,   0,   0,   0,
+     21,   0,   0,   0,  10,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      29,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     110, 101, 116, 112, 117, 116,  46,  99,
-     97, 112, 110, 112,  58,  68, 105, 115,
-     99, 111, 110, 110, 101,  99, 116,  82,
-    101, 115, 112, 111, 110, 115, 101,   0,
-      0,   0,   0,   0,   1,   0,   1,   0,
+     97, 112, 110, 112,  58,  83, 101, 115,
+    115, 105, 111, 110,  46, 112, 117, 115,
+    104,  36,  80,  97, 114,  97, 109, 115,
+      0,   0,   0,   0,   0,   0,   0,   0,
       4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
@@ -553,191 +574,985 @@ static const ::capnp::_::AlignedData<33> b_977d693f820bb9cd = {
       0,   0,   0,   0,   0,   0,   0,   0,
       8,   0,   0,   0,   3,   0,   1,   0,
      20,   0,   0,   0,   2,   0,   1,   0,
-    101, 114, 114, 111, 114,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
+    101, 118, 101, 110, 116,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     27, 162, 196,  21,   0,  63,  71, 240,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_977d693f820bb9cd = b_977d693f820bb9cd.words;
+::capnp::word const* const bp_e0a3c21aa35e5dd7 = b_e0a3c21aa35e5dd7.words;
 #if !CAPNP_LITE
-static const uint16_t m_977d693f820bb9cd[] = {0};
-static const uint16_t i_977d693f820bb9cd[] = {0};
-const ::capnp::_::RawSchema s_977d693f820bb9cd = {
-  0x977d693f820bb9cd, b_977d693f820bb9cd.words, 33, nullptr, m_977d693f820bb9cd,
-  0, 1, i_977d693f820bb9cd, nullptr, nullptr, { &s_977d693f820bb9cd, nullptr, nullptr, 0, 0, nullptr }, false
+static const ::capnp::_::RawSchema* const d_e0a3c21aa35e5dd7[] = {
+  &s_f0473f0015c4a21b,
+};
+static const uint16_t m_e0a3c21aa35e5dd7[] = {0};
+static const uint16_t i_e0a3c21aa35e5dd7[] = {0};
+const ::capnp::_::RawSchema s_e0a3c21aa35e5dd7 = {
+  0xe0a3c21aa35e5dd7, b_e0a3c21aa35e5dd7.words, 33, d_e0a3c21aa35e5dd7, m_e0a3c21aa35e5dd7,
+  1, 1, i_e0a3c21aa35e5dd7, nullptr, nullptr, { &s_e0a3c21aa35e5dd7, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<41> b_f0473f0015c4a21b = {
+static const ::capnp::_::AlignedData<17> b_feb5f9e1b528b13a = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-     27, 162, 196,  21,   0,  63,  71, 240,
-     13,   0,   0,   0,   1,   0,   1,   0,
-     79, 101,  81, 227, 209, 112, 242, 149,
-      2,   0,   7,   0,   0,   0,   0,   0,
+     58, 177,  40, 181, 225, 249, 181, 254,
+     21,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  18,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 154,   0,   0,   0,
-     29,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     25,   0,   0,   0, 119,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     110, 101, 116, 112, 117, 116,  46,  99,
-     97, 112, 110, 112,  58,  69, 118, 101,
-    110, 116,   0,   0,   0,   0,   0,   0,
-      0,   0,   0,   0,   1,   0,   1,   0,
-      8,   0,   0,   0,   3,   0,   4,   0,
+     97, 112, 110, 112,  58,  83, 101, 115,
+    115, 105, 111, 110,  46, 112, 117, 115,
+    104,  36,  82, 101, 115, 117, 108, 116,
+    115,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_feb5f9e1b528b13a = b_feb5f9e1b528b13a.words;
+#if !CAPNP_LITE
+const ::capnp::_::RawSchema s_feb5f9e1b528b13a = {
+  0xfeb5f9e1b528b13a, b_feb5f9e1b528b13a.words, 17, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_feb5f9e1b528b13a, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<37> b_c32ea4e7dad07bae = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    174, 123, 208, 218, 231, 164,  46, 195,
+     21,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-      0,   0,   1,   0,   0,   0,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     41,   0,   0,   0,  82,   0,   0,   0,
+     21,   0,   0,   0,  50,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     40,   0,   0,   0,   3,   0,   1,   0,
-     52,   0,   0,   0,   2,   0,   1,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-      1,   0,   0,   0,   0,   0,   0,   0,
-    136,  63, 115,  42,   5, 206, 243, 254,
-     49,   0,   0,   0,  42,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0,  63,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    115, 101, 115, 115, 105, 111, 110,  73,
-    100,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  83, 101, 115,
+    115, 105, 111, 110,  46, 112, 117, 115,
+    104,  66,  97, 116,  99, 104,  36,  80,
+     97, 114,  97, 109, 115,   0,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  58,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     12,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     36,   0,   0,   0,   2,   0,   1,   0,
+    101, 118, 101, 110, 116, 115,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    105, 110, 102, 111,   0,   0,   0,   0, }
+      0,   0,   0,   0,   3,   0,   1,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     27, 162, 196,  21,   0,  63,  71, 240,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_f0473f0015c4a21b = b_f0473f0015c4a21b.words;
+::capnp::word const* const bp_c32ea4e7dad07bae = b_c32ea4e7dad07bae.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_f0473f0015c4a21b[] = {
+static const ::capnp::_::RawSchema* const d_c32ea4e7dad07bae[] = {
+  &s_f0473f0015c4a21b,
+};
+static const uint16_t m_c32ea4e7dad07bae[] = {0};
+static const uint16_t i_c32ea4e7dad07bae[] = {0};
+const ::capnp::_::RawSchema s_c32ea4e7dad07bae = {
+  0xc32ea4e7dad07bae, b_c32ea4e7dad07bae.words, 37, d_c32ea4e7dad07bae, m_c32ea4e7dad07bae,
+  1, 1, i_c32ea4e7dad07bae, nullptr, nullptr, { &s_c32ea4e7dad07bae, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<17> b_919b58f03f937184 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    132, 113, 147,  63, 240,  88, 155, 145,
+     21,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  58,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  83, 101, 115,
+    115, 105, 111, 110,  46, 112, 117, 115,
+    104,  66,  97, 116,  99, 104,  36,  82,
+    101, 115, 117, 108, 116, 115,   0,   0, }
+};
+::capnp::word const* const bp_919b58f03f937184 = b_919b58f03f937184.words;
+#if !CAPNP_LITE
+const ::capnp::_::RawSchema s_919b58f03f937184 = {
+  0x919b58f03f937184, b_919b58f03f937184.words, 17, nullptr, nullptr,
+  0, 0, nullptr, nullptr, nullptr, { &s_919b58f03f937184, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<33> b_bb3c7ba8aef1292c = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     44,  41, 241, 174, 168, 123,  60, 187,
+     21,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  58,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0,  63,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  83, 101, 115,
+    115, 105, 111, 110,  46, 112, 117, 115,
+    104,  83, 116, 114, 101,  97, 109,  36,
+     80,  97, 114,  97, 109, 115,   0,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  50,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    101, 118, 101, 110, 116,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     27, 162, 196,  21,   0,  63,  71, 240,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_bb3c7ba8aef1292c = b_bb3c7ba8aef1292c.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_bb3c7ba8aef1292c[] = {
+  &s_f0473f0015c4a21b,
+};
+static const uint16_t m_bb3c7ba8aef1292c[] = {0};
+static const uint16_t i_bb3c7ba8aef1292c[] = {0};
+const ::capnp::_::RawSchema s_bb3c7ba8aef1292c = {
+  0xbb3c7ba8aef1292c, b_bb3c7ba8aef1292c.words, 33, d_bb3c7ba8aef1292c, m_bb3c7ba8aef1292c,
+  1, 1, i_bb3c7ba8aef1292c, nullptr, nullptr, { &s_bb3c7ba8aef1292c, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<66> b_b2ed5d8c33a99cfc = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    252, 156, 169,  51, 140,  93, 237, 178,
+     13,   0,   0,   0,   1,   0,   1,   0,
+     79, 101,  81, 227, 209, 112, 242, 149,
+      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 226,   0,   0,   0,
+     33,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0, 175,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  67, 111, 110,
+    110, 101,  99, 116,  82, 101, 113, 117,
+    101, 115, 116,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+     12,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     69,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     68,   0,   0,   0,   3,   0,   1,   0,
+     80,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     77,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     76,   0,   0,   0,   3,   0,   1,   0,
+     88,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     85,   0,   0,   0,  98,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     84,   0,   0,   0,   3,   0,   1,   0,
+     96,   0,   0,   0,   2,   0,   1,   0,
+    117, 115, 101, 114,  68,  97, 116,  97,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    100,  97, 116,  97, 103, 114,  97, 109,
+    115,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    112,  97, 114, 105, 116, 121,  71, 114,
+    111, 117, 112,   0,   0,   0,   0,   0,
+      6,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      6,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_b2ed5d8c33a99cfc = b_b2ed5d8c33a99cfc.words;
+#if !CAPNP_LITE
+static const uint16_t m_b2ed5d8c33a99cfc[] = {1, 2, 0};
+static const uint16_t i_b2ed5d8c33a99cfc[] = {0, 1, 2};
+const ::capnp::_::RawSchema s_b2ed5d8c33a99cfc = {
+  0xb2ed5d8c33a99cfc, b_b2ed5d8c33a99cfc.words, 66, nullptr, m_b2ed5d8c33a99cfc,
+  0, 3, i_b2ed5d8c33a99cfc, nullptr, nullptr, { &s_b2ed5d8c33a99cfc, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<73> b_e8db608ad47956cb = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    203,  86, 121, 212, 138,  96, 219, 232,
+     13,   0,   0,   0,   1,   0,   2,   0,
+     79, 101,  81, 227, 209, 112, 242, 149,
+      2,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 234,   0,   0,   0,
+     33,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0, 231,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  67, 111, 110,
+    110, 101,  99, 116,  82, 101, 115, 112,
+    111, 110, 115, 101,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+     16,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+     51, 218,  75,  68,  98, 253, 150, 186,
+     97,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     73,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     68,   0,   0,   0,   3,   0,   1,   0,
+     80,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   3,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     77,   0,   0,   0, 106,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     76,   0,   0,   0,   3,   0,   1,   0,
+     88,   0,   0,   0,   2,   0,   1,   0,
+      3,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   4,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     85,   0,   0,   0, 114,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     84,   0,   0,   0,   3,   0,   1,   0,
+     96,   0,   0,   0,   2,   0,   1,   0,
+    109, 101, 115, 115,  97, 103, 101,   0,
+    115, 101, 115, 115, 105, 111, 110,   0,
+     17,   0,   0,   0,   0,   0,   0,   0,
+     24, 137, 252,  89,  66, 199, 120, 243,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     17,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    100,  97, 116,  97, 103, 114,  97, 109,
+     80, 111, 114, 116,   0,   0,   0,   0,
+      7,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      7,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    100,  97, 116,  97, 103, 114,  97, 109,
+     84, 111, 107, 101, 110,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_e8db608ad47956cb = b_e8db608ad47956cb.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_e8db608ad47956cb[] = {
+  &s_ba96fd62444bda33,
+  &s_f378c74259fc8918,
+};
+static const uint16_t m_e8db608ad47956cb[] = {2, 3, 0, 1};
+static const uint16_t i_e8db608ad47956cb[] = {0, 1, 2, 3};
+const ::capnp::_::RawSchema s_e8db608ad47956cb = {
+  0xe8db608ad47956cb, b_e8db608ad47956cb.words, 73, d_e8db608ad47956cb, m_e8db608ad47956cb,
+  2, 4, i_e8db608ad47956cb, nullptr, nullptr, { &s_e8db608ad47956cb, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<49> b_ba96fd62444bda33 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     51, 218,  75,  68,  98, 253, 150, 186,
+     29,   0,   0,   0,   1,   0,   2,   0,
+    203,  86, 121, 212, 138,  96, 219, 232,
+      2,   0,   7,   0,   1,   0,   2,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  42,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0, 119,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  67, 111, 110,
+    110, 101,  99, 116,  82, 101, 115, 112,
+    111, 110, 115, 101,  46, 109, 101, 115,
+    115,  97, 103, 101,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
+      0,   0, 255, 255,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     41,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     40,   0,   0,   0,   3,   0,   1,   0,
+     52,   0,   0,   0,   2,   0,   1,   0,
+      1,   0, 254, 255,   0,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     49,   0,   0,   0,  50,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     44,   0,   0,   0,   3,   0,   1,   0,
+     56,   0,   0,   0,   2,   0,   1,   0,
+    115, 101, 115, 115, 105, 111, 110,  73,
+    100,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    101, 114, 114, 111, 114,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_ba96fd62444bda33 = b_ba96fd62444bda33.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_ba96fd62444bda33[] = {
+  &s_e8db608ad47956cb,
+};
+static const uint16_t m_ba96fd62444bda33[] = {1, 0};
+static const uint16_t i_ba96fd62444bda33[] = {0, 1};
+const ::capnp::_::RawSchema s_ba96fd62444bda33 = {
+  0xba96fd62444bda33, b_ba96fd62444bda33.words, 49, d_ba96fd62444bda33, m_ba96fd62444bda33,
+  1, 2, i_ba96fd62444bda33, nullptr, nullptr, { &s_ba96fd62444bda33, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<34> b_a542553ee6cb6157 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     87,  97, 203, 230,  62,  85,  66, 165,
+     13,   0,   0,   0,   1,   0,   0,   0,
+     79, 101,  81, 227, 209, 112, 242, 149,
+      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 250,   0,   0,   0,
+     33,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0,  63,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  68, 105, 115,
+     99, 111, 110, 110, 101,  99, 116,  82,
+    101, 113, 117, 101, 115, 116,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   3,   0,   1,   0,
+     24,   0,   0,   0,   2,   0,   1,   0,
+    115, 101, 115, 115, 105, 111, 110,  73,
+    100,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_a542553ee6cb6157 = b_a542553ee6cb6157.words;
+#if !CAPNP_LITE
+static const uint16_t m_a542553ee6cb6157[] = {0};
+static const uint16_t i_a542553ee6cb6157[] = {0};
+const ::capnp::_::RawSchema s_a542553ee6cb6157 = {
+  0xa542553ee6cb6157, b_a542553ee6cb6157.words, 34, nullptr, m_a542553ee6cb6157,
+  0, 1, i_a542553ee6cb6157, nullptr, nullptr, { &s_a542553ee6cb6157, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<33> b_977d693f820bb9cd = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    205, 185,  11, 130,  63, 105, 125, 151,
+     13,   0,   0,   0,   1,   0,   0,   0,
+     79, 101,  81, 227, 209, 112, 242, 149,
+      1,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,   2,   1,   0,   0,
+     33,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0,  63,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  68, 105, 115,
+     99, 111, 110, 110, 101,  99, 116,  82,
+    101, 115, 112, 111, 110, 115, 101,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+      4,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  50,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      8,   0,   0,   0,   3,   0,   1,   0,
+     20,   0,   0,   0,   2,   0,   1,   0,
+    101, 114, 114, 111, 114,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_977d693f820bb9cd = b_977d693f820bb9cd.words;
+#if !CAPNP_LITE
+static const uint16_t m_977d693f820bb9cd[] = {0};
+static const uint16_t i_977d693f820bb9cd[] = {0};
+const ::capnp::_::RawSchema s_977d693f820bb9cd = {
+  0x977d693f820bb9cd, b_977d693f820bb9cd.words, 33, nullptr, m_977d693f820bb9cd,
+  0, 1, i_977d693f820bb9cd, nullptr, nullptr, { &s_977d693f820bb9cd, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<41> b_f0473f0015c4a21b = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     27, 162, 196,  21,   0,  63,  71, 240,
+     13,   0,   0,   0,   1,   0,   1,   0,
+     79, 101,  81, 227, 209, 112, 242, 149,
+      2,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 154,   0,   0,   0,
+     29,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     25,   0,   0,   0, 119,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  69, 118, 101,
+    110, 116,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     41,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     40,   0,   0,   0,   3,   0,   1,   0,
+     52,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+    136,  63, 115,  42,   5, 206, 243, 254,
+     49,   0,   0,   0,  42,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    115, 101, 115, 115, 105, 111, 110,  73,
+    100,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    105, 110, 102, 111,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_f0473f0015c4a21b = b_f0473f0015c4a21b.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_f0473f0015c4a21b[] = {
   &s_fef3ce052a733f88,
 };
-static const uint16_t m_f0473f0015c4a21b[] = {1, 0};
-static const uint16_t i_f0473f0015c4a21b[] = {0, 1};
-const ::capnp::_::RawSchema s_f0473f0015c4a21b = {
-  0xf0473f0015c4a21b, b_f0473f0015c4a21b.words, 41, d_f0473f0015c4a21b, m_f0473f0015c4a21b,
-  1, 2, i_f0473f0015c4a21b, nullptr, nullptr, { &s_f0473f0015c4a21b, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_f0473f0015c4a21b[] = {1, 0};
+static const uint16_t i_f0473f0015c4a21b[] = {0, 1};
+const ::capnp::_::RawSchema s_f0473f0015c4a21b = {
+  0xf0473f0015c4a21b, b_f0473f0015c4a21b.words, 41, d_f0473f0015c4a21b, m_f0473f0015c4a21b,
+  1, 2, i_f0473f0015c4a21b, nullptr, nullptr, { &s_f0473f0015c4a21b, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<95> b_fef3ce052a733f88 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    136,  63, 115,  42,   5, 206, 243, 254,
+     19,   0,   0,   0,   1,   0,   1,   0,
+     27, 162, 196,  21,   0,  63,  71, 240,
+      2,   0,   7,   0,   1,   0,   5,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 194,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  31,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  69, 118, 101,
+    110, 116,  46, 105, 110, 102, 111,   0,
+     20,   0,   0,   0,   3,   0,   4,   0,
+      0,   0, 255, 255,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    125,   0,   0,   0,  98,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    124,   0,   0,   0,   3,   0,   1,   0,
+    136,   0,   0,   0,   2,   0,   1,   0,
+      1,   0, 254, 255,   1,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    133,   0,   0,   0,  98,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    132,   0,   0,   0,   3,   0,   1,   0,
+    144,   0,   0,   0,   2,   0,   1,   0,
+      2,   0, 253, 255,   1,   0,   0,   0,
+      0,   0,   1,   0,   3,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    141,   0,   0,   0,  90,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    140,   0,   0,   0,   3,   0,   1,   0,
+    152,   0,   0,   0,   2,   0,   1,   0,
+      3,   0, 252, 255,   1,   0,   0,   0,
+      0,   0,   1,   0,   4,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    149,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    148,   0,   0,   0,   3,   0,   1,   0,
+    160,   0,   0,   0,   2,   0,   1,   0,
+      4,   0, 251, 255,   1,   0,   0,   0,
+      0,   0,   1,   0,   5,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    157,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    152,   0,   0,   0,   3,   0,   1,   0,
+    164,   0,   0,   0,   2,   0,   1,   0,
+    109, 111, 117, 115, 101,  77, 111, 116,
+    105, 111, 110,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     48,  61, 112, 226,  77, 219, 233, 149,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    109, 111, 117, 115, 101,  66, 117, 116,
+    116, 111, 110,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    137,  42, 163, 136, 156, 217,  42, 219,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    109, 111, 117, 115, 101,  87, 104, 101,
+    101, 108,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    137, 220, 238,  73,  24,  20, 200, 176,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    107, 101, 121,  98, 111,  97, 114, 100,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+    190, 196, 222, 109, 190,  42, 219, 232,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    119, 105, 110, 100, 111, 119,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     51, 104,  86,  96, 250, 118, 249, 147,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_fef3ce052a733f88 = b_fef3ce052a733f88.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_fef3ce052a733f88[] = {
+  &s_93f976fa60566833,
+  &s_95e9db4de2703d30,
+  &s_b0c8141849eedc89,
+  &s_db2ad99c88a32a89,
+  &s_e8db2abe6ddec4be,
+  &s_f0473f0015c4a21b,
+};
+static const uint16_t m_fef3ce052a733f88[] = {3, 1, 0, 2, 4};
+static const uint16_t i_fef3ce052a733f88[] = {0, 1, 2, 3, 4};
+const ::capnp::_::RawSchema s_fef3ce052a733f88 = {
+  0xfef3ce052a733f88, b_fef3ce052a733f88.words, 95, d_fef3ce052a733f88, m_fef3ce052a733f88,
+  6, 5, i_fef3ce052a733f88, nullptr, nullptr, { &s_fef3ce052a733f88, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<93> b_939f05b1ae245f34 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+     52,  95,  36, 174, 177,   5, 159, 147,
+     13,   0,   0,   0,   1,   0,   3,   0,
+     79, 101,  81, 227, 209, 112, 242, 149,
+      2,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 178,   0,   0,   0,
+     29,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     25,   0,   0,   0,  31,   1,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  68,  97, 116,
+     97, 103, 114,  97, 109,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+     20,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    125,   0,   0,   0,  50,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    120,   0,   0,   0,   3,   0,   1,   0,
+    132,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    129,   0,   0,   0,  74,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    128,   0,   0,   0,   3,   0,   1,   0,
+    140,   0,   0,   0,   2,   0,   1,   0,
+      2,   0,   0,   0,   2,   0,   0,   0,
+      0,   0,   1,   0,   2,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    137,   0,   0,   0,  50,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    132,   0,   0,   0,   3,   0,   1,   0,
+    144,   0,   0,   0,   2,   0,   1,   0,
+      3,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   3,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    141,   0,   0,   0,  50,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    136,   0,   0,   0,   3,   0,   1,   0,
+    148,   0,   0,   0,   2,   0,   1,   0,
+      4,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   4,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    145,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    140,   0,   0,   0,   3,   0,   1,   0,
+    152,   0,   0,   0,   2,   0,   1,   0,
+    116, 111, 107, 101, 110,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    115, 101, 113, 117, 101, 110,  99, 101,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    101, 112, 111,  99, 104,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    101, 118, 101, 110, 116,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     27, 162, 196,  21,   0,  63,  71, 240,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    112,  97, 114, 105, 116, 121,   0,   0,
+     13,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_939f05b1ae245f34 = b_939f05b1ae245f34.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_939f05b1ae245f34[] = {
+  &s_f0473f0015c4a21b,
+};
+static const uint16_t m_939f05b1ae245f34[] = {2, 3, 4, 1, 0};
+static const uint16_t i_939f05b1ae245f34[] = {0, 1, 2, 3, 4};
+const ::capnp::_::RawSchema s_939f05b1ae245f34 = {
+  0x939f05b1ae245f34, b_939f05b1ae245f34.words, 93, d_939f05b1ae245f34, m_939f05b1ae245f34,
+  1, 5, i_939f05b1ae245f34, nullptr, nullptr, { &s_939f05b1ae245f34, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<52> b_8d7bb36fef4fd8d3 = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    211, 216,  79, 239, 111, 179, 123, 141,
+     13,   0,   0,   0,   1,   0,   0,   0,
+     79, 101,  81, 227, 209, 112, 242, 149,
+      2,   0,   7,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 194,   0,   0,   0,
+     29,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     25,   0,   0,   0, 119,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  69, 118, 101,
+    110, 116,  66,  97, 116,  99, 104,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+      8,   0,   0,   0,   3,   0,   4,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     41,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     40,   0,   0,   0,   3,   0,   1,   0,
+     52,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   1,   0,   0,   0,
+      0,   0,   1,   0,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     49,   0,   0,   0,  58,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     44,   0,   0,   0,   3,   0,   1,   0,
+     72,   0,   0,   0,   2,   0,   1,   0,
+    115, 101, 115, 115, 105, 111, 110,  73,
+    100,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    101, 118, 101, 110, 116, 115,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   3,   0,   1,   0,
+     16,   0,   0,   0,   0,   0,   0,   0,
+     27, 162, 196,  21,   0,  63,  71, 240,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     14,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_8d7bb36fef4fd8d3 = b_8d7bb36fef4fd8d3.words;
+#if !CAPNP_LITE
+static const ::capnp::_::RawSchema* const d_8d7bb36fef4fd8d3[] = {
+  &s_f0473f0015c4a21b,
+};
+static const uint16_t m_8d7bb36fef4fd8d3[] = {1, 0};
+static const uint16_t i_8d7bb36fef4fd8d3[] = {0, 1};
+const ::capnp::_::RawSchema s_8d7bb36fef4fd8d3 = {
+  0x8d7bb36fef4fd8d3, b_8d7bb36fef4fd8d3.words, 52, d_8d7bb36fef4fd8d3, m_8d7bb36fef4fd8d3,
+  1, 2, i_8d7bb36fef4fd8d3, nullptr, nullptr, { &s_8d7bb36fef4fd8d3, nullptr, nullptr, 0, 0, nullptr }, false
+};
+#endif  // !CAPNP_LITE
+static const ::capnp::_::AlignedData<31> b_b1997e1bf14eddeb = {
+  {   0,   0,   0,   0,   5,   0,   6,   0,
+    235, 221,  78, 241,  27, 126, 153, 177,
+     13,   0,   0,   0,   2,   0,   0,   0,
+     79, 101,  81, 227, 209, 112, 242, 149,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 210,   0,   0,   0,
+     33,   0,   0,   0,   7,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0,  79,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    110, 101, 116, 112, 117, 116,  46,  99,
+     97, 112, 110, 112,  58,  76, 111, 103,
+     69, 110, 116, 114, 121,  75, 105, 110,
+    100,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
+     12,   0,   0,   0,   1,   0,   2,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     29,   0,   0,   0,  50,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      2,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,  90,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    101, 118, 101, 110, 116,   0,   0,   0,
+     99, 111, 110, 110, 101,  99, 116,   0,
+    100, 105, 115,  99, 111, 110, 110, 101,
+     99, 116,   0,   0,   0,   0,   0,   0, }
+};
+::capnp::word const* const bp_b1997e1bf14eddeb = b_b1997e1bf14eddeb.words;
+#if !CAPNP_LITE
+static const uint16_t m_b1997e1bf14eddeb[] = {1, 2, 0};
+const ::capnp::_::RawSchema s_b1997e1bf14eddeb = {
+  0xb1997e1bf14eddeb, b_b1997e1bf14eddeb.words, 31, nullptr, m_b1997e1bf14eddeb,
+  0, 3, nullptr, nullptr, nullptr, { &s_b1997e1bf14eddeb, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
-static const ::capnp::_::AlignedData<95> b_fef3ce052a733f88 = {
+CAPNP_DEFINE_ENUM(LogEntryKind_b1997e1bf14eddeb, b1997e1bf14eddeb);
+static const ::capnp::_::AlignedData<94> b_ca1a688af528f2c0 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
-    136,  63, 115,  42,   5, 206, 243, 254,
-     19,   0,   0,   0,   1,   0,   1,   0,
-     27, 162, 196,  21,   0,  63,  71, 240,
-      2,   0,   7,   0,   1,   0,   5,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0, 194,   0,   0,   0,
+    192, 242,  40, 245, 138, 104,  26, 202,
+     13,   0,   0,   0,   1,   0,   2,   0,
+     79, 101,  81, 227, 209, 112, 242, 149,
+      3,   0,   7,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+     21,   0,   0,   0, 178,   0,   0,   0,
+     29,   0,   0,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     21,   0,   0,   0,  31,   1,   0,   0,
+     25,   0,   0,   0,  31,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     110, 101, 116, 112, 117, 116,  46,  99,
-     97, 112, 110, 112,  58,  69, 118, 101,
-    110, 116,  46, 105, 110, 102, 111,   0,
+     97, 112, 110, 112,  58,  76, 111, 103,
+     69, 110, 116, 114, 121,   0,   0,   0,
+      0,   0,   0,   0,   1,   0,   1,   0,
      20,   0,   0,   0,   3,   0,   4,   0,
-      0,   0, 255, 255,   1,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   1,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    125,   0,   0,   0,  42,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    120,   0,   0,   0,   3,   0,   1,   0,
+    132,   0,   0,   0,   2,   0,   1,   0,
+      1,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    125,   0,   0,   0,  98,   0,   0,   0,
+    129,   0,   0,   0,  66,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     124,   0,   0,   0,   3,   0,   1,   0,
     136,   0,   0,   0,   2,   0,   1,   0,
-      1,   0, 254, 255,   1,   0,   0,   0,
+      2,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   2,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     133,   0,   0,   0,  98,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     132,   0,   0,   0,   3,   0,   1,   0,
     144,   0,   0,   0,   2,   0,   1,   0,
-      2,   0, 253, 255,   1,   0,   0,   0,
+      3,   0,   0,   0,   1,   0,   0,   0,
       0,   0,   1,   0,   3,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    141,   0,   0,   0,  90,   0,   0,   0,
+    141,   0,   0,   0,  50,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    140,   0,   0,   0,   3,   0,   1,   0,
-    152,   0,   0,   0,   2,   0,   1,   0,
-      3,   0, 252, 255,   1,   0,   0,   0,
+    136,   0,   0,   0,   3,   0,   1,   0,
+    148,   0,   0,   0,   2,   0,   1,   0,
+      4,   0,   0,   0,   2,   0,   0,   0,
       0,   0,   1,   0,   4,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    149,   0,   0,   0,  74,   0,   0,   0,
-      0,   0,   0,   0,   0,   0,   0,   0,
-    148,   0,   0,   0,   3,   0,   1,   0,
-    160,   0,   0,   0,   2,   0,   1,   0,
-      4,   0, 251, 255,   1,   0,   0,   0,
-      0,   0,   1,   0,   5,   0,   0,   0,
+    145,   0,   0,   0,  74,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    157,   0,   0,   0,  58,   0,   0,   0,
+    144,   0,   0,   0,   3,   0,   1,   0,
+    156,   0,   0,   0,   2,   0,   1,   0,
+    107, 105, 110, 100,   0,   0,   0,   0,
+     15,   0,   0,   0,   0,   0,   0,   0,
+    235, 221,  78, 241,  27, 126, 153, 177,
       0,   0,   0,   0,   0,   0,   0,   0,
-    152,   0,   0,   0,   3,   0,   1,   0,
-    164,   0,   0,   0,   2,   0,   1,   0,
-    109, 111, 117, 115, 101,  77, 111, 116,
-    105, 111, 110,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-     48,  61, 112, 226,  77, 219, 233, 149,
       0,   0,   0,   0,   0,   0,   0,   0,
+     15,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+    115, 101, 115, 115, 105, 111, 110,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    109, 111, 117, 115, 101,  66, 117, 116,
-    116, 111, 110,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    137,  42, 163, 136, 156, 217,  42, 219,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
+     12,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    109, 111, 117, 115, 101,  87, 104, 101,
-    101, 108,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-    137, 220, 238,  73,  24,  20, 200, 176,
+    114, 101,  99, 101, 105, 118, 101,  84,
+    105, 109, 101,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      9,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    107, 101, 121,  98, 111,  97, 114, 100,
       0,   0,   0,   0,   0,   0,   0,   0,
+    101, 118, 101, 110, 116,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
-    190, 196, 222, 109, 190,  42, 219, 232,
+     27, 162, 196,  21,   0,  63,  71, 240,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
      16,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    119, 105, 110, 100, 111, 119,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
-     51, 104,  86,  96, 250, 118, 249, 147,
+    117, 115, 101, 114,  68,  97, 116,  97,
       0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     16,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     13,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
-::capnp::word const* const bp_fef3ce052a733f88 = b_fef3ce052a733f88.words;
+::capnp::word const* const bp_ca1a688af528f2c0 = b_ca1a688af528f2c0.words;
 #if !CAPNP_LITE
-static const ::capnp::_::RawSchema* const d_fef3ce052a733f88[] = {
-  &s_93f976fa60566833,
-  &s_95e9db4de2703d30,
-  &s_b0c8141849eedc89,
-  &s_db2ad99c88a32a89,
-  &s_e8db2abe6ddec4be,
+static const ::capnp::_::RawSchema* const d_ca1a688af528f2c0[] = {
+  &s_b1997e1bf14eddeb,
   &s_f0473f0015c4a21b,
 };
-static const uint16_t m_fef3ce052a733f88[] = {3, 1, 0, 2, 4};
-static const uint16_t i_fef3ce052a733f88[] = {0, 1, 2, 3, 4};
-const ::capnp::_::RawSchema s_fef3ce052a733f88 = {
-  0xfef3ce052a733f88, b_fef3ce052a733f88.words, 95, d_fef3ce052a733f88, m_fef3ce052a733f88,
-  6, 5, i_fef3ce052a733f88, nullptr, nullptr, { &s_fef3ce052a733f88, nullptr, nullptr, 0, 0, nullptr }, false
+static const uint16_t m_ca1a688af528f2c0[] = {3, 0, 2, 1, 4};
+static const uint16_t i_ca1a688af528f2c0[] = {0, 1, 2, 3, 4};
+const ::capnp::_::RawSchema s_ca1a688af528f2c0 = {
+  0xca1a688af528f2c0, b_ca1a688af528f2c0.words, 94, d_ca1a688af528f2c0, m_ca1a688af528f2c0,
+  2, 5, i_ca1a688af528f2c0, nullptr, nullptr, { &s_ca1a688af528f2c0, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
 static const ::capnp::_::AlignedData<26> b_cdd23f44c925b297 = {
@@ -915,7 +1730,7 @@ const ::capnp::_::RawSchema s_aae0ea937045b314 = {
 };
 #endif  // !CAPNP_LITE
 CAPNP_DEFINE_ENUM(WindowEventType_aae0ea937045b314, aae0ea937045b314);
-static const ::capnp::_::AlignedData<132> b_95e9db4de2703d30 = {
+static const ::capnp::_::AlignedData<147> b_95e9db4de2703d30 = {
   {   0,   0,   0,   0,   5,   0,   6,   0,
      48,  61, 112, 226,  77, 219, 233, 149,
      13,   0,   0,   0,   1,   0,   4,   0,
@@ -925,7 +1740,7 @@ static const ::capnp::_::AlignedData<132> b_95e9db4de2703d30 = {
      21,   0,   0,   0, 242,   0,   0,   0,
      33,   0,   0,   0,  23,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-     45,   0,   0,   0, 143,   1,   0,   0,
+     45,   0,   0,   0, 199,   1,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
     110, 101, 116, 112, 117, 116,  46,  99,
@@ -937,56 +1752,63 @@ static const ::capnp::_::AlignedData<132> b_95e9db4de2703d30 = {
       1,   0,   0,   0, 122,   0,   0,   0,
      77, 111, 117, 115, 101,  83, 116,  97,
     116, 101,  77,  97, 115, 107,   0,   0,
-     28,   0,   0,   0,   3,   0,   4,   0,
+     32,   0,   0,   0,   3,   0,   4,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    181,   0,   0,   0,  82,   0,   0,   0,
+    209,   0,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    180,   0,   0,   0,   3,   0,   1,   0,
-    192,   0,   0,   0,   2,   0,   1,   0,
+    208,   0,   0,   0,   3,   0,   1,   0,
+    220,   0,   0,   0,   2,   0,   1,   0,
       1,   0,   0,   0,   2,   0,   0,   0,
       0,   0,   1,   0,   1,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    189,   0,   0,   0,  74,   0,   0,   0,
+    217,   0,   0,   0,  74,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    188,   0,   0,   0,   3,   0,   1,   0,
-    200,   0,   0,   0,   2,   0,   1,   0,
+    216,   0,   0,   0,   3,   0,   1,   0,
+    228,   0,   0,   0,   2,   0,   1,   0,
       2,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   1,   0,   2,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    197,   0,   0,   0,  82,   0,   0,   0,
+    225,   0,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    196,   0,   0,   0,   3,   0,   1,   0,
-    208,   0,   0,   0,   2,   0,   1,   0,
+    224,   0,   0,   0,   3,   0,   1,   0,
+    236,   0,   0,   0,   2,   0,   1,   0,
       3,   0,   0,   0,   3,   0,   0,   0,
       0,   0,   1,   0,   3,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    205,   0,   0,   0,  18,   0,   0,   0,
+    233,   0,   0,   0,  18,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    200,   0,   0,   0,   3,   0,   1,   0,
-    212,   0,   0,   0,   2,   0,   1,   0,
+    228,   0,   0,   0,   3,   0,   1,   0,
+    240,   0,   0,   0,   2,   0,   1,   0,
       4,   0,   0,   0,   4,   0,   0,   0,
       0,   0,   1,   0,   4,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    209,   0,   0,   0,  18,   0,   0,   0,
+    237,   0,   0,   0,  18,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    204,   0,   0,   0,   3,   0,   1,   0,
-    216,   0,   0,   0,   2,   0,   1,   0,
+    232,   0,   0,   0,   3,   0,   1,   0,
+    244,   0,   0,   0,   2,   0,   1,   0,
       5,   0,   0,   0,   5,   0,   0,   0,
       0,   0,   1,   0,   5,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    213,   0,   0,   0,  82,   0,   0,   0,
+    241,   0,   0,   0,  82,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    212,   0,   0,   0,   3,   0,   1,   0,
-    224,   0,   0,   0,   2,   0,   1,   0,
+    240,   0,   0,   0,   3,   0,   1,   0,
+    252,   0,   0,   0,   2,   0,   1,   0,
       6,   0,   0,   0,   6,   0,   0,   0,
       0,   0,   1,   0,   6,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    221,   0,   0,   0,  82,   0,   0,   0,
+    249,   0,   0,   0,  82,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    248,   0,   0,   0,   3,   0,   1,   0,
+      4,   1,   0,   0,   2,   0,   1,   0,
+      7,   0,   0,   0,  28,   0,   0,   0,
+      0,   0,   1,   0,   7,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
-    220,   0,   0,   0,   3,   0,   1,   0,
-    232,   0,   0,   0,   2,   0,   1,   0,
+      1,   1,   0,   0,  66,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+    252,   0,   0,   0,   3,   0,   1,   0,
+      8,   1,   0,   0,   2,   0,   1,   0,
     116, 105, 109, 101, 115, 116,  97, 109,
     112,   0,   0,   0,   0,   0,   0,   0,
       9,   0,   0,   0,   0,   0,   0,   0,
@@ -1047,6 +1869,14 @@ static const ::capnp::_::AlignedData<132> b_95e9db4de2703d30 = {
       0,   0,   0,   0,   0,   0,   0,   0,
       4,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+     98, 117, 116, 116, 111, 110, 115,   0,
+      6,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
+      6,   0,   0,   0,   0,   0,   0,   0,
+      0,   0,   0,   0,   0,   0,   0,   0,
       0,   0,   0,   0,   0,   0,   0,   0, }
 };
 ::capnp::word const* const bp_95e9db4de2703d30 = b_95e9db4de2703d30.words;
@@ -1054,11 +1884,11 @@ static const ::capnp::_::AlignedData<132> b_95e9db4de2703d30 = {
 static const ::capnp::_::RawSchema* const d_95e9db4de2703d30[] = {
   &s_dbb615788c241744,
 };
-static const uint16_t m_95e9db4de2703d30[] = {5, 6, 2, 0, 1, 3, 4};
-static const uint16_t i_95e9db4de2703d30[] = {0, 1, 2, 3, 4, 5, 6};
+static const uint16_t m_95e9db4de2703d30[] = {7, 5, 6, 2, 0, 1, 3, 4};
+static const uint16_t i_95e9db4de2703d30[] = {0, 1, 2, 3, 4, 5, 6, 7};
 const ::capnp::_::RawSchema s_95e9db4de2703d30 = {
-  0x95e9db4de2703d30, b_95e9db4de2703d30.words, 132, d_95e9db4de2703d30, m_95e9db4de2703d30,
-  1, 7, i_95e9db4de2703d30, nullptr, nullptr, { &s_95e9db4de2703d30, nullptr, nullptr, 0, 0, nullptr }, false
+  0x95e9db4de2703d30, b_95e9db4de2703d30.words, 147, d_95e9db4de2703d30, m_95e9db4de2703d30,
+  1, 8, i_95e9db4de2703d30, nullptr, nullptr, { &s_95e9db4de2703d30, nullptr, nullptr, 0, 0, nullptr }, false
 };
 #endif  // !CAPNP_LITE
 static const ::capnp::_::AlignedData<95> b_dbb615788c241744 = {
@@ -1663,7 +2493,7 @@ namespace rpc {
 ::capnp::Request< ::netput::rpc::Netput::ConnectParams,  ::netput::rpc::Netput::ConnectResults>
 Netput::Client::connectRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
   return newCall< ::netput::rpc::Netput::ConnectParams,  ::netput::rpc::Netput::ConnectResults>(
-      0xfa4a1bc90f7e051bull, 0, sizeHint, {true});
+      0xfa4a1bc90f7e051bull, 0, sizeHint, {false});
 }
 ::kj::Promise<void> Netput::Server::connect(ConnectContext) {
   return ::capnp::Capability::Server::internalUnimplemented(
@@ -1690,6 +2520,26 @@ Netput::Client::disconnectRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
       "netput.capnp:Netput", "disconnect",
       0xfa4a1bc90f7e051bull, 2);
 }
+::capnp::Request< ::netput::rpc::Netput::PushBatchParams,  ::netput::rpc::Netput::PushBatchResults>
+Netput::Client::pushBatchRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
+  return newCall< ::netput::rpc::Netput::PushBatchParams,  ::netput::rpc::Netput::PushBatchResults>(
+      0xfa4a1bc90f7e051bull, 3, sizeHint, {true});
+}
+::kj::Promise<void> Netput::Server::pushBatch(PushBatchContext) {
+  return ::capnp::Capability::Server::internalUnimplemented(
+      "netput.capnp:Netput", "pushBatch",
+      0xfa4a1bc90f7e051bull, 3);
+}
+::capnp::StreamingRequest< ::netput::rpc::Netput::PushStreamParams>
+Netput::Client::pushStreamRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
+  return newStreamingCall< ::netput::rpc::Netput::PushStreamParams>(
+      0xfa4a1bc90f7e051bull, 4, sizeHint, {true});
+}
+::kj::Promise<void> Netput::Server::pushStream(PushStreamContext) {
+  return ::capnp::Capability::Server::internalUnimplemented(
+      "netput.capnp:Netput", "pushStream",
+      0xfa4a1bc90f7e051bull, 4);
+}
 ::capnp::Capability::Server::DispatchCallResult Netput::Server::dispatchCall(
     uint64_t interfaceId, uint16_t methodId,
     ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context) {
@@ -1725,6 +2575,22 @@ Netput::Client::disconnectRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
         false,
         false
       };
+    case 3:
+      return {
+        pushBatch(::capnp::Capability::Server::internalGetTypedContext<
+             ::netput::rpc::Netput::PushBatchParams,  ::netput::rpc::Netput::PushBatchResults>(context)),
+        false,
+        false
+      };
+    case 4:
+      return {
+        kj::evalNow([&]() {
+          return pushStream(::capnp::Capability::Server::internalGetTypedStreamingContext<
+               ::netput::rpc::Netput::PushStreamParams>(context));
+        }),
+        true,
+        false
+      };
     default:
       (void)context;
       return ::capnp::Capability::Server::internalUnimplemented(
@@ -1814,6 +2680,186 @@ constexpr ::capnp::_::RawSchema const* Netput::DisconnectResults::_capnpPrivate:
 #endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
 #endif  // !CAPNP_LITE
 
+// Netput::PushBatchParams
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t Netput::PushBatchParams::_capnpPrivate::dataWordSize;
+constexpr uint16_t Netput::PushBatchParams::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind Netput::PushBatchParams::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* Netput::PushBatchParams::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// Netput::PushBatchResults
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t Netput::PushBatchResults::_capnpPrivate::dataWordSize;
+constexpr uint16_t Netput::PushBatchResults::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind Netput::PushBatchResults::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* Netput::PushBatchResults::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// Netput::PushStreamParams
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t Netput::PushStreamParams::_capnpPrivate::dataWordSize;
+constexpr uint16_t Netput::PushStreamParams::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind Netput::PushStreamParams::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* Netput::PushStreamParams::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+#if !CAPNP_LITE
+::capnp::Request< ::netput::rpc::Session::PushParams,  ::netput::rpc::Session::PushResults>
+Session::Client::pushRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
+  return newCall< ::netput::rpc::Session::PushParams,  ::netput::rpc::Session::PushResults>(
+      0xf378c74259fc8918ull, 0, sizeHint, {true});
+}
+::kj::Promise<void> Session::Server::push(PushContext) {
+  return ::capnp::Capability::Server::internalUnimplemented(
+      "netput.capnp:Session", "push",
+      0xf378c74259fc8918ull, 0);
+}
+::capnp::Request< ::netput::rpc::Session::PushBatchParams,  ::netput::rpc::Session::PushBatchResults>
+Session::Client::pushBatchRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
+  return newCall< ::netput::rpc::Session::PushBatchParams,  ::netput::rpc::Session::PushBatchResults>(
+      0xf378c74259fc8918ull, 1, sizeHint, {true});
+}
+::kj::Promise<void> Session::Server::pushBatch(PushBatchContext) {
+  return ::capnp::Capability::Server::internalUnimplemented(
+      "netput.capnp:Session", "pushBatch",
+      0xf378c74259fc8918ull, 1);
+}
+::capnp::StreamingRequest< ::netput::rpc::Session::PushStreamParams>
+Session::Client::pushStreamRequest(::kj::Maybe< ::capnp::MessageSize> sizeHint) {
+  return newStreamingCall< ::netput::rpc::Session::PushStreamParams>(
+      0xf378c74259fc8918ull, 2, sizeHint, {true});
+}
+::kj::Promise<void> Session::Server::pushStream(PushStreamContext) {
+  return ::capnp::Capability::Server::internalUnimplemented(
+      "netput.capnp:Session", "pushStream",
+      0xf378c74259fc8918ull, 2);
+}
+::capnp::Capability::Server::DispatchCallResult Session::Server::dispatchCall(
+    uint64_t interfaceId, uint16_t methodId,
+    ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context) {
+  switch (interfaceId) {
+    case 0xf378c74259fc8918ull:
+      return dispatchCallInternal(methodId, context);
+    default:
+      return internalUnimplemented("netput.capnp:Session", interfaceId);
+  }
+}
+::capnp::Capability::Server::DispatchCallResult Session::Server::dispatchCallInternal(
+    uint16_t methodId,
+    ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context) {
+  switch (methodId) {
+    case 0:
+      return {
+        push(::capnp::Capability::Server::internalGetTypedContext<
+             ::netput::rpc::Session::PushParams,  ::netput::rpc::Session::PushResults>(context)),
+        false,
+        false
+      };
+    case 1:
+      return {
+        pushBatch(::capnp::Capability::Server::internalGetTypedContext<
+             ::netput::rpc::Session::PushBatchParams,  ::netput::rpc::Session::PushBatchResults>(context)),
+        false,
+        false
+      };
+    case 2:
+      return {
+        kj::evalNow([&]() {
+          return pushStream(::capnp::Capability::Server::internalGetTypedStreamingContext<
+               ::netput::rpc::Session::PushStreamParams>(context));
+        }),
+        true,
+        false
+      };
+    default:
+      (void)context;
+      return ::capnp::Capability::Server::internalUnimplemented(
+          "netput.capnp:Session",
+          0xf378c74259fc8918ull, methodId);
+  }
+}
+#endif  // !CAPNP_LITE
+
+// Session
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind Session::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* Session::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// Session::PushParams
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t Session::PushParams::_capnpPrivate::dataWordSize;
+constexpr uint16_t Session::PushParams::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind Session::PushParams::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* Session::PushParams::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// Session::PushResults
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t Session::PushResults::_capnpPrivate::dataWordSize;
+constexpr uint16_t Session::PushResults::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind Session::PushResults::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* Session::PushResults::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// Session::PushBatchParams
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t Session::PushBatchParams::_capnpPrivate::dataWordSize;
+constexpr uint16_t Session::PushBatchParams::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind Session::PushBatchParams::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* Session::PushBatchParams::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// Session::PushBatchResults
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t Session::PushBatchResults::_capnpPrivate::dataWordSize;
+constexpr uint16_t Session::PushBatchResults::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind Session::PushBatchResults::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* Session::PushBatchResults::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// Session::PushStreamParams
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t Session::PushStreamParams::_capnpPrivate::dataWordSize;
+constexpr uint16_t Session::PushStreamParams::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind Session::PushStreamParams::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* Session::PushStreamParams::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
 // ConnectRequest
 #if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
 constexpr uint16_t ConnectRequest::_capnpPrivate::dataWordSize;
@@ -1898,6 +2944,42 @@ constexpr ::capnp::_::RawSchema const* Event::Info::_capnpPrivate::schema;
 #endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
 #endif  // !CAPNP_LITE
 
+// Datagram
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t Datagram::_capnpPrivate::dataWordSize;
+constexpr uint16_t Datagram::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind Datagram::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* Datagram::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// EventBatch
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t EventBatch::_capnpPrivate::dataWordSize;
+constexpr uint16_t EventBatch::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind EventBatch::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* EventBatch::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
+// LogEntry
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr uint16_t LogEntry::_capnpPrivate::dataWordSize;
+constexpr uint16_t LogEntry::_capnpPrivate::pointerCount;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#if !CAPNP_LITE
+#if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+constexpr ::capnp::Kind LogEntry::_capnpPrivate::kind;
+constexpr ::capnp::_::RawSchema const* LogEntry::_capnpPrivate::schema;
+#endif  // !CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
+#endif  // !CAPNP_LITE
+
 // MouseMotionEvent
 #if CAPNP_NEED_REDUNDANT_CONSTEXPR_DECL
 constexpr uint16_t MouseMotionEvent::_capnpPrivate::dataWordSize;
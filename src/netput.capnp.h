@@ -15,6 +15,7 @@
 #error "Version mismatch between generated code and library headers.  You must use the same version of the Cap'n Proto compiler and library."
 #endif
 
+#include <capnp/stream.capnp.h>
 
 CAPNP_BEGIN_HEADER
 
@@ -28,6 +29,15 @@ CAPNP_DECLARE_SCHEMA(b0e01c3b79eba209);
 CAPNP_DECLARE_SCHEMA(b8dd9d40f500f1a5);
 CAPNP_DECLARE_SCHEMA(91053e416163d71e);
 CAPNP_DECLARE_SCHEMA(f1c4f972666019a7);
+CAPNP_DECLARE_SCHEMA(baab85123f5ae595);
+CAPNP_DECLARE_SCHEMA(c54ea05fd5d58c13);
+CAPNP_DECLARE_SCHEMA(8c555a1146f08550);
+CAPNP_DECLARE_SCHEMA(f378c74259fc8918);
+CAPNP_DECLARE_SCHEMA(e0a3c21aa35e5dd7);
+CAPNP_DECLARE_SCHEMA(feb5f9e1b528b13a);
+CAPNP_DECLARE_SCHEMA(c32ea4e7dad07bae);
+CAPNP_DECLARE_SCHEMA(919b58f03f937184);
+CAPNP_DECLARE_SCHEMA(bb3c7ba8aef1292c);
 CAPNP_DECLARE_SCHEMA(b2ed5d8c33a99cfc);
 CAPNP_DECLARE_SCHEMA(e8db608ad47956cb);
 CAPNP_DECLARE_SCHEMA(ba96fd62444bda33);
@@ -35,6 +45,16 @@ CAPNP_DECLARE_SCHEMA(a542553ee6cb6157);
 CAPNP_DECLARE_SCHEMA(977d693f820bb9cd);
 CAPNP_DECLARE_SCHEMA(f0473f0015c4a21b);
 CAPNP_DECLARE_SCHEMA(fef3ce052a733f88);
+CAPNP_DECLARE_SCHEMA(939f05b1ae245f34);
+CAPNP_DECLARE_SCHEMA(8d7bb36fef4fd8d3);
+CAPNP_DECLARE_SCHEMA(b1997e1bf14eddeb);
+enum class LogEntryKind_b1997e1bf14eddeb: uint16_t {
+  EVENT,
+  CONNECT,
+  DISCONNECT,
+};
+CAPNP_DECLARE_ENUM(LogEntryKind, b1997e1bf14eddeb);
+CAPNP_DECLARE_SCHEMA(ca1a688af528f2c0);
 CAPNP_DECLARE_SCHEMA(cdd23f44c925b297);
 enum class InputState_cdd23f44c925b297: uint16_t {
   RELEASED,
@@ -93,6 +113,9 @@ struct Netput {
   struct PushResults;
   struct DisconnectParams;
   struct DisconnectResults;
+  struct PushBatchParams;
+  struct PushBatchResults;
+  struct PushStreamParams;
 
   #if !CAPNP_LITE
   struct _capnpPrivate {
@@ -192,6 +215,148 @@ struct Netput::DisconnectResults {
   };
 };
 
+struct Netput::PushBatchParams {
+  PushBatchParams() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(baab85123f5ae595, 0, 1)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct Netput::PushBatchResults {
+  PushBatchResults() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(c54ea05fd5d58c13, 0, 0)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct Netput::PushStreamParams {
+  PushStreamParams() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(8c555a1146f08550, 0, 1)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct Session {
+  Session() = delete;
+
+#if !CAPNP_LITE
+  class Client;
+  class Server;
+#endif  // !CAPNP_LITE
+
+  struct PushParams;
+  struct PushResults;
+  struct PushBatchParams;
+  struct PushBatchResults;
+  struct PushStreamParams;
+
+  #if !CAPNP_LITE
+  struct _capnpPrivate {
+    CAPNP_DECLARE_INTERFACE_HEADER(f378c74259fc8918)
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+  };
+  #endif  // !CAPNP_LITE
+};
+
+struct Session::PushParams {
+  PushParams() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(e0a3c21aa35e5dd7, 0, 1)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct Session::PushResults {
+  PushResults() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(feb5f9e1b528b13a, 0, 0)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct Session::PushBatchParams {
+  PushBatchParams() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(c32ea4e7dad07bae, 0, 1)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct Session::PushBatchResults {
+  PushBatchResults() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(919b58f03f937184, 0, 0)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct Session::PushStreamParams {
+  PushStreamParams() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(bb3c7ba8aef1292c, 0, 1)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
 struct ConnectRequest {
   ConnectRequest() = delete;
 
@@ -200,7 +365,7 @@ struct ConnectRequest {
   class Pipeline;
 
   struct _capnpPrivate {
-    CAPNP_DECLARE_STRUCT_HEADER(b2ed5d8c33a99cfc, 0, 1)
+    CAPNP_DECLARE_STRUCT_HEADER(b2ed5d8c33a99cfc, 1, 1)
     #if !CAPNP_LITE
     static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
     #endif  // !CAPNP_LITE
@@ -216,7 +381,7 @@ struct ConnectResponse {
   struct Message;
 
   struct _capnpPrivate {
-    CAPNP_DECLARE_STRUCT_HEADER(e8db608ad47956cb, 1, 1)
+    CAPNP_DECLARE_STRUCT_HEADER(e8db608ad47956cb, 2, 2)
     #if !CAPNP_LITE
     static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
     #endif  // !CAPNP_LITE
@@ -235,7 +400,7 @@ struct ConnectResponse::Message {
   };
 
   struct _capnpPrivate {
-    CAPNP_DECLARE_STRUCT_HEADER(ba96fd62444bda33, 1, 1)
+    CAPNP_DECLARE_STRUCT_HEADER(ba96fd62444bda33, 2, 2)
     #if !CAPNP_LITE
     static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
     #endif  // !CAPNP_LITE
@@ -310,6 +475,53 @@ struct Event::Info {
   };
 };
 
+struct Datagram {
+  Datagram() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(939f05b1ae245f34, 3, 2)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+struct EventBatch {
+  EventBatch() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(8d7bb36fef4fd8d3, 0, 2)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
+typedef ::capnp::schemas::LogEntryKind_b1997e1bf14eddeb LogEntryKind;
+
+struct LogEntry {
+  LogEntry() = delete;
+
+  class Reader;
+  class Builder;
+  class Pipeline;
+
+  struct _capnpPrivate {
+    CAPNP_DECLARE_STRUCT_HEADER(ca1a688af528f2c0, 2, 3)
+    #if !CAPNP_LITE
+    static constexpr ::capnp::_::RawBrandedSchema const* brand() { return &schema->defaultBrand; }
+    #endif  // !CAPNP_LITE
+  };
+};
+
 typedef ::capnp::schemas::InputState_cdd23f44c925b297 InputState;
 
 typedef ::capnp::schemas::MouseButton_83b374bc3dd69907 MouseButton;
@@ -434,6 +646,10 @@ public:
       ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
   ::capnp::Request< ::netput::rpc::Netput::DisconnectParams,  ::netput::rpc::Netput::DisconnectResults> disconnectRequest(
       ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
+  ::capnp::Request< ::netput::rpc::Netput::PushBatchParams,  ::netput::rpc::Netput::PushBatchResults> pushBatchRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
+  ::capnp::StreamingRequest< ::netput::rpc::Netput::PushStreamParams> pushStreamRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
 
 protected:
   Client() = default;
@@ -462,6 +678,13 @@ protected:
   typedef  ::netput::rpc::Netput::DisconnectResults DisconnectResults;
   typedef ::capnp::CallContext<DisconnectParams, DisconnectResults> DisconnectContext;
   virtual ::kj::Promise<void> disconnect(DisconnectContext context);
+  typedef  ::netput::rpc::Netput::PushBatchParams PushBatchParams;
+  typedef  ::netput::rpc::Netput::PushBatchResults PushBatchResults;
+  typedef ::capnp::CallContext<PushBatchParams, PushBatchResults> PushBatchContext;
+  virtual ::kj::Promise<void> pushBatch(PushBatchContext context);
+  typedef  ::netput::rpc::Netput::PushStreamParams PushStreamParams;
+  typedef ::capnp::StreamingCallContext<PushStreamParams> PushStreamContext;
+  virtual ::kj::Promise<void> pushStream(PushStreamContext context);
 
   inline  ::netput::rpc::Netput::Client thisCap() {
     return ::capnp::Capability::Server::thisCap()
@@ -955,9 +1178,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class ConnectRequest::Reader {
+class Netput::PushBatchParams::Reader {
 public:
-  typedef ConnectRequest Reads;
+  typedef PushBatchParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -972,8 +1195,8 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUserData() const;
-  inline  ::capnp::Data::Reader getUserData() const;
+  inline bool hasBatch() const;
+  inline  ::netput::rpc::EventBatch::Reader getBatch() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -987,9 +1210,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class ConnectRequest::Builder {
+class Netput::PushBatchParams::Builder {
 public:
-  typedef ConnectRequest Builds;
+  typedef PushBatchParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1003,12 +1226,12 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasUserData();
-  inline  ::capnp::Data::Builder getUserData();
-  inline void setUserData( ::capnp::Data::Reader value);
-  inline  ::capnp::Data::Builder initUserData(unsigned int size);
-  inline void adoptUserData(::capnp::Orphan< ::capnp::Data>&& value);
-  inline ::capnp::Orphan< ::capnp::Data> disownUserData();
+  inline bool hasBatch();
+  inline  ::netput::rpc::EventBatch::Builder getBatch();
+  inline void setBatch( ::netput::rpc::EventBatch::Reader value);
+  inline  ::netput::rpc::EventBatch::Builder initBatch();
+  inline void adoptBatch(::capnp::Orphan< ::netput::rpc::EventBatch>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::EventBatch> disownBatch();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -1020,14 +1243,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class ConnectRequest::Pipeline {
+class Netput::PushBatchParams::Pipeline {
 public:
-  typedef ConnectRequest Pipelines;
+  typedef PushBatchParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
+  inline  ::netput::rpc::EventBatch::Pipeline getBatch();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -1036,9 +1260,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class ConnectResponse::Reader {
+class Netput::PushBatchResults::Reader {
 public:
-  typedef ConnectResponse Reads;
+  typedef PushBatchResults Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1053,8 +1277,6 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline typename Message::Reader getMessage() const;
-
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -1067,9 +1289,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class ConnectResponse::Builder {
+class Netput::PushBatchResults::Builder {
 public:
-  typedef ConnectResponse Builds;
+  typedef PushBatchResults Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1083,9 +1305,6 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline typename Message::Builder getMessage();
-  inline typename Message::Builder initMessage();
-
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -1096,15 +1315,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class ConnectResponse::Pipeline {
+class Netput::PushBatchResults::Pipeline {
 public:
-  typedef ConnectResponse Pipelines;
+  typedef PushBatchResults Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline typename Message::Pipeline getMessage();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -1113,9 +1331,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class ConnectResponse::Message::Reader {
+class Netput::PushStreamParams::Reader {
 public:
-  typedef Message Reads;
+  typedef PushStreamParams Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1130,14 +1348,8 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline Which which() const;
-  inline bool isSessionId() const;
-  inline bool hasSessionId() const;
-  inline  ::capnp::Text::Reader getSessionId() const;
-
-  inline bool isError() const;
-  inline bool hasError() const;
-  inline  ::capnp::Text::Reader getError() const;
+  inline bool hasEvent() const;
+  inline  ::netput::rpc::Event::Reader getEvent() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -1151,9 +1363,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class ConnectResponse::Message::Builder {
+class Netput::PushStreamParams::Builder {
 public:
-  typedef Message Builds;
+  typedef PushStreamParams Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1167,22 +1379,12 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline Which which();
-  inline bool isSessionId();
-  inline bool hasSessionId();
-  inline  ::capnp::Text::Builder getSessionId();
-  inline void setSessionId( ::capnp::Text::Reader value);
-  inline  ::capnp::Text::Builder initSessionId(unsigned int size);
-  inline void adoptSessionId(::capnp::Orphan< ::capnp::Text>&& value);
-  inline ::capnp::Orphan< ::capnp::Text> disownSessionId();
-
-  inline bool isError();
-  inline bool hasError();
-  inline  ::capnp::Text::Builder getError();
-  inline void setError( ::capnp::Text::Reader value);
-  inline  ::capnp::Text::Builder initError(unsigned int size);
-  inline void adoptError(::capnp::Orphan< ::capnp::Text>&& value);
-  inline ::capnp::Orphan< ::capnp::Text> disownError();
+  inline bool hasEvent();
+  inline  ::netput::rpc::Event::Builder getEvent();
+  inline void setEvent( ::netput::rpc::Event::Reader value);
+  inline  ::netput::rpc::Event::Builder initEvent();
+  inline void adoptEvent(::capnp::Orphan< ::netput::rpc::Event>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::Event> disownEvent();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -1194,14 +1396,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class ConnectResponse::Message::Pipeline {
+class Netput::PushStreamParams::Pipeline {
 public:
-  typedef Message Pipelines;
+  typedef PushStreamParams Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
+  inline  ::netput::rpc::Event::Pipeline getEvent();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -1210,28 +1413,933 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class DisconnectRequest::Reader {
+#if !CAPNP_LITE
+class Session::Client
+    : public virtual ::capnp::Capability::Client {
 public:
-  typedef DisconnectRequest Reads;
+  typedef Session Calls;
+  typedef Session Reads;
 
-  Reader() = default;
-  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+  Client(decltype(nullptr));
+  explicit Client(::kj::Own< ::capnp::ClientHook>&& hook);
+  template <typename _t, typename = ::kj::EnableIf< ::kj::canConvert<_t*, Server*>()>>
+  Client(::kj::Own<_t>&& server);
+  template <typename _t, typename = ::kj::EnableIf< ::kj::canConvert<_t*, Client*>()>>
+  Client(::kj::Promise<_t>&& promise);
+  Client(::kj::Exception&& exception);
+  Client(Client&) = default;
+  Client(Client&&) = default;
+  Client& operator=(Client& other);
+  Client& operator=(Client&& other);
 
-  inline ::capnp::MessageSize totalSize() const {
-    return _reader.totalSize().asPublic();
-  }
+  ::capnp::Request< ::netput::rpc::Session::PushParams,  ::netput::rpc::Session::PushResults> pushRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
+  ::capnp::Request< ::netput::rpc::Session::PushBatchParams,  ::netput::rpc::Session::PushBatchResults> pushBatchRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
+  ::capnp::StreamingRequest< ::netput::rpc::Session::PushStreamParams> pushStreamRequest(
+      ::kj::Maybe< ::capnp::MessageSize> sizeHint = nullptr);
 
-#if !CAPNP_LITE
-  inline ::kj::StringTree toString() const {
-    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
-  }
-#endif  // !CAPNP_LITE
+protected:
+  Client() = default;
+};
 
-  inline bool hasSessionId() const;
-  inline  ::capnp::Text::Reader getSessionId() const;
+class Session::Server
+    : public virtual ::capnp::Capability::Server {
+public:
+  typedef Session Serves;
 
-private:
-  ::capnp::_::StructReader _reader;
+  ::capnp::Capability::Server::DispatchCallResult dispatchCall(
+      uint64_t interfaceId, uint16_t methodId,
+      ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context)
+      override;
+
+protected:
+  typedef  ::netput::rpc::Session::PushParams PushParams;
+  typedef  ::netput::rpc::Session::PushResults PushResults;
+  typedef ::capnp::CallContext<PushParams, PushResults> PushContext;
+  virtual ::kj::Promise<void> push(PushContext context);
+  typedef  ::netput::rpc::Session::PushBatchParams PushBatchParams;
+  typedef  ::netput::rpc::Session::PushBatchResults PushBatchResults;
+  typedef ::capnp::CallContext<PushBatchParams, PushBatchResults> PushBatchContext;
+  virtual ::kj::Promise<void> pushBatch(PushBatchContext context);
+  typedef  ::netput::rpc::Session::PushStreamParams PushStreamParams;
+  typedef ::capnp::StreamingCallContext<PushStreamParams> PushStreamContext;
+  virtual ::kj::Promise<void> pushStream(PushStreamContext context);
+
+  inline  ::netput::rpc::Session::Client thisCap() {
+    return ::capnp::Capability::Server::thisCap()
+        .template castAs< ::netput::rpc::Session>();
+  }
+
+  ::capnp::Capability::Server::DispatchCallResult dispatchCallInternal(
+      uint16_t methodId,
+      ::capnp::CallContext< ::capnp::AnyPointer, ::capnp::AnyPointer> context);
+};
+#endif  // !CAPNP_LITE
+
+class Session::PushParams::Reader {
+public:
+  typedef PushParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasEvent() const;
+  inline  ::netput::rpc::Event::Reader getEvent() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class Session::PushParams::Builder {
+public:
+  typedef PushParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasEvent();
+  inline  ::netput::rpc::Event::Builder getEvent();
+  inline void setEvent( ::netput::rpc::Event::Reader value);
+  inline  ::netput::rpc::Event::Builder initEvent();
+  inline void adoptEvent(::capnp::Orphan< ::netput::rpc::Event>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::Event> disownEvent();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class Session::PushParams::Pipeline {
+public:
+  typedef PushParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::netput::rpc::Event::Pipeline getEvent();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class Session::PushResults::Reader {
+public:
+  typedef PushResults Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class Session::PushResults::Builder {
+public:
+  typedef PushResults Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class Session::PushResults::Pipeline {
+public:
+  typedef PushResults Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class Session::PushBatchParams::Reader {
+public:
+  typedef PushBatchParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasEvents() const;
+  inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Reader getEvents() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class Session::PushBatchParams::Builder {
+public:
+  typedef PushBatchParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasEvents();
+  inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Builder getEvents();
+  inline void setEvents( ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Reader value);
+  inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Builder initEvents(unsigned int size);
+  inline void adoptEvents(::capnp::Orphan< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>> disownEvents();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class Session::PushBatchParams::Pipeline {
+public:
+  typedef PushBatchParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class Session::PushBatchResults::Reader {
+public:
+  typedef PushBatchResults Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class Session::PushBatchResults::Builder {
+public:
+  typedef PushBatchResults Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class Session::PushBatchResults::Pipeline {
+public:
+  typedef PushBatchResults Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class Session::PushStreamParams::Reader {
+public:
+  typedef PushStreamParams Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasEvent() const;
+  inline  ::netput::rpc::Event::Reader getEvent() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class Session::PushStreamParams::Builder {
+public:
+  typedef PushStreamParams Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasEvent();
+  inline  ::netput::rpc::Event::Builder getEvent();
+  inline void setEvent( ::netput::rpc::Event::Reader value);
+  inline  ::netput::rpc::Event::Builder initEvent();
+  inline void adoptEvent(::capnp::Orphan< ::netput::rpc::Event>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::Event> disownEvent();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class Session::PushStreamParams::Pipeline {
+public:
+  typedef PushStreamParams Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::netput::rpc::Event::Pipeline getEvent();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class ConnectRequest::Reader {
+public:
+  typedef ConnectRequest Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasUserData() const;
+  inline  ::capnp::Data::Reader getUserData() const;
+
+  inline bool getDatagrams() const;
+
+  inline  ::uint8_t getParityGroup() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class ConnectRequest::Builder {
+public:
+  typedef ConnectRequest Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasUserData();
+  inline  ::capnp::Data::Builder getUserData();
+  inline void setUserData( ::capnp::Data::Reader value);
+  inline  ::capnp::Data::Builder initUserData(unsigned int size);
+  inline void adoptUserData(::capnp::Orphan< ::capnp::Data>&& value);
+  inline ::capnp::Orphan< ::capnp::Data> disownUserData();
+
+  inline bool getDatagrams();
+  inline void setDatagrams(bool value);
+
+  inline  ::uint8_t getParityGroup();
+  inline void setParityGroup( ::uint8_t value);
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class ConnectRequest::Pipeline {
+public:
+  typedef ConnectRequest Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class ConnectResponse::Reader {
+public:
+  typedef ConnectResponse Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline typename Message::Reader getMessage() const;
+
+  inline bool hasSession() const;
+#if !CAPNP_LITE
+  inline  ::netput::rpc::Session::Client getSession() const;
+#endif  // !CAPNP_LITE
+
+  inline  ::uint16_t getDatagramPort() const;
+
+  inline  ::uint64_t getDatagramToken() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class ConnectResponse::Builder {
+public:
+  typedef ConnectResponse Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline typename Message::Builder getMessage();
+  inline typename Message::Builder initMessage();
+
+  inline bool hasSession();
+#if !CAPNP_LITE
+  inline  ::netput::rpc::Session::Client getSession();
+  inline void setSession( ::netput::rpc::Session::Client&& value);
+  inline void setSession( ::netput::rpc::Session::Client& value);
+  inline void adoptSession(::capnp::Orphan< ::netput::rpc::Session>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::Session> disownSession();
+#endif  // !CAPNP_LITE
+
+  inline  ::uint16_t getDatagramPort();
+  inline void setDatagramPort( ::uint16_t value);
+
+  inline  ::uint64_t getDatagramToken();
+  inline void setDatagramToken( ::uint64_t value);
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class ConnectResponse::Pipeline {
+public:
+  typedef ConnectResponse Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline typename Message::Pipeline getMessage();
+  inline  ::netput::rpc::Session::Client getSession();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class ConnectResponse::Message::Reader {
+public:
+  typedef Message Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline Which which() const;
+  inline bool isSessionId() const;
+  inline bool hasSessionId() const;
+  inline  ::capnp::Text::Reader getSessionId() const;
+
+  inline bool isError() const;
+  inline bool hasError() const;
+  inline  ::capnp::Text::Reader getError() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class ConnectResponse::Message::Builder {
+public:
+  typedef Message Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline Which which();
+  inline bool isSessionId();
+  inline bool hasSessionId();
+  inline  ::capnp::Text::Builder getSessionId();
+  inline void setSessionId( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initSessionId(unsigned int size);
+  inline void adoptSessionId(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownSessionId();
+
+  inline bool isError();
+  inline bool hasError();
+  inline  ::capnp::Text::Builder getError();
+  inline void setError( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initError(unsigned int size);
+  inline void adoptError(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownError();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class ConnectResponse::Message::Pipeline {
+public:
+  typedef Message Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class DisconnectRequest::Reader {
+public:
+  typedef DisconnectRequest Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasSessionId() const;
+  inline  ::capnp::Text::Reader getSessionId() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class DisconnectRequest::Builder {
+public:
+  typedef DisconnectRequest Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasSessionId();
+  inline  ::capnp::Text::Builder getSessionId();
+  inline void setSessionId( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initSessionId(unsigned int size);
+  inline void adoptSessionId(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownSessionId();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class DisconnectRequest::Pipeline {
+public:
+  typedef DisconnectRequest Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class DisconnectResponse::Reader {
+public:
+  typedef DisconnectResponse Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasError() const;
+  inline  ::capnp::Text::Reader getError() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class DisconnectResponse::Builder {
+public:
+  typedef DisconnectResponse Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline bool hasError();
+  inline  ::capnp::Text::Builder getError();
+  inline void setError( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initError(unsigned int size);
+  inline void adoptError(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownError();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class DisconnectResponse::Pipeline {
+public:
+  typedef DisconnectResponse Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class Event::Reader {
+public:
+  typedef Event Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline bool hasSessionId() const;
+  inline  ::capnp::Text::Reader getSessionId() const;
+
+  inline typename Info::Reader getInfo() const;
+
+private:
+  ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
   friend struct ::capnp::ToDynamic_;
   template <typename, ::capnp::Kind>
@@ -1242,9 +2350,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class DisconnectRequest::Builder {
+class Event::Builder {
 public:
-  typedef DisconnectRequest Builds;
+  typedef Event Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1265,6 +2373,9 @@ public:
   inline void adoptSessionId(::capnp::Orphan< ::capnp::Text>&& value);
   inline ::capnp::Orphan< ::capnp::Text> disownSessionId();
 
+  inline typename Info::Builder getInfo();
+  inline typename Info::Builder initInfo();
+
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -1275,14 +2386,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class DisconnectRequest::Pipeline {
+class Event::Pipeline {
 public:
-  typedef DisconnectRequest Pipelines;
+  typedef Event Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
+  inline typename Info::Pipeline getInfo();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -1291,9 +2403,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class DisconnectResponse::Reader {
+class Event::Info::Reader {
 public:
-  typedef DisconnectResponse Reads;
+  typedef Info Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1308,8 +2420,26 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline bool hasError() const;
-  inline  ::capnp::Text::Reader getError() const;
+  inline Which which() const;
+  inline bool isMouseMotion() const;
+  inline bool hasMouseMotion() const;
+  inline  ::netput::rpc::MouseMotionEvent::Reader getMouseMotion() const;
+
+  inline bool isMouseButton() const;
+  inline bool hasMouseButton() const;
+  inline  ::netput::rpc::MouseButtonEvent::Reader getMouseButton() const;
+
+  inline bool isMouseWheel() const;
+  inline bool hasMouseWheel() const;
+  inline  ::netput::rpc::MouseWheelEvent::Reader getMouseWheel() const;
+
+  inline bool isKeyboard() const;
+  inline bool hasKeyboard() const;
+  inline  ::netput::rpc::KeyboardEvent::Reader getKeyboard() const;
+
+  inline bool isWindow() const;
+  inline bool hasWindow() const;
+  inline  ::netput::rpc::WindowEvent::Reader getWindow() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -1323,9 +2453,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class DisconnectResponse::Builder {
+class Event::Info::Builder {
 public:
-  typedef DisconnectResponse Builds;
+  typedef Info Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1339,12 +2469,46 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline bool hasError();
-  inline  ::capnp::Text::Builder getError();
-  inline void setError( ::capnp::Text::Reader value);
-  inline  ::capnp::Text::Builder initError(unsigned int size);
-  inline void adoptError(::capnp::Orphan< ::capnp::Text>&& value);
-  inline ::capnp::Orphan< ::capnp::Text> disownError();
+  inline Which which();
+  inline bool isMouseMotion();
+  inline bool hasMouseMotion();
+  inline  ::netput::rpc::MouseMotionEvent::Builder getMouseMotion();
+  inline void setMouseMotion( ::netput::rpc::MouseMotionEvent::Reader value);
+  inline  ::netput::rpc::MouseMotionEvent::Builder initMouseMotion();
+  inline void adoptMouseMotion(::capnp::Orphan< ::netput::rpc::MouseMotionEvent>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::MouseMotionEvent> disownMouseMotion();
+
+  inline bool isMouseButton();
+  inline bool hasMouseButton();
+  inline  ::netput::rpc::MouseButtonEvent::Builder getMouseButton();
+  inline void setMouseButton( ::netput::rpc::MouseButtonEvent::Reader value);
+  inline  ::netput::rpc::MouseButtonEvent::Builder initMouseButton();
+  inline void adoptMouseButton(::capnp::Orphan< ::netput::rpc::MouseButtonEvent>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::MouseButtonEvent> disownMouseButton();
+
+  inline bool isMouseWheel();
+  inline bool hasMouseWheel();
+  inline  ::netput::rpc::MouseWheelEvent::Builder getMouseWheel();
+  inline void setMouseWheel( ::netput::rpc::MouseWheelEvent::Reader value);
+  inline  ::netput::rpc::MouseWheelEvent::Builder initMouseWheel();
+  inline void adoptMouseWheel(::capnp::Orphan< ::netput::rpc::MouseWheelEvent>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::MouseWheelEvent> disownMouseWheel();
+
+  inline bool isKeyboard();
+  inline bool hasKeyboard();
+  inline  ::netput::rpc::KeyboardEvent::Builder getKeyboard();
+  inline void setKeyboard( ::netput::rpc::KeyboardEvent::Reader value);
+  inline  ::netput::rpc::KeyboardEvent::Builder initKeyboard();
+  inline void adoptKeyboard(::capnp::Orphan< ::netput::rpc::KeyboardEvent>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::KeyboardEvent> disownKeyboard();
+
+  inline bool isWindow();
+  inline bool hasWindow();
+  inline  ::netput::rpc::WindowEvent::Builder getWindow();
+  inline void setWindow( ::netput::rpc::WindowEvent::Reader value);
+  inline  ::netput::rpc::WindowEvent::Builder initWindow();
+  inline void adoptWindow(::capnp::Orphan< ::netput::rpc::WindowEvent>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::WindowEvent> disownWindow();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -1356,9 +2520,9 @@ private:
 };
 
 #if !CAPNP_LITE
-class DisconnectResponse::Pipeline {
+class Event::Info::Pipeline {
 public:
-  typedef DisconnectResponse Pipelines;
+  typedef Info Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
@@ -1372,9 +2536,116 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class Event::Reader {
+class Datagram::Reader {
 public:
-  typedef Event Reads;
+  typedef Datagram Reads;
+
+  Reader() = default;
+  inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
+
+  inline ::capnp::MessageSize totalSize() const {
+    return _reader.totalSize().asPublic();
+  }
+
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const {
+    return ::capnp::_::structString(_reader, *_capnpPrivate::brand());
+  }
+#endif  // !CAPNP_LITE
+
+  inline  ::uint64_t getToken() const;
+
+  inline  ::uint64_t getSequence() const;
+
+  inline  ::uint64_t getEpoch() const;
+
+  inline bool hasEvent() const;
+  inline  ::netput::rpc::Event::Reader getEvent() const;
+
+  inline bool hasParity() const;
+  inline  ::capnp::Data::Reader getParity() const;
+
+private:
+  ::capnp::_::StructReader _reader;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::List;
+  friend class ::capnp::MessageBuilder;
+  friend class ::capnp::Orphanage;
+};
+
+class Datagram::Builder {
+public:
+  typedef Datagram Builds;
+
+  Builder() = delete;  // Deleted to discourage incorrect usage.
+                       // You can explicitly initialize to nullptr instead.
+  inline Builder(decltype(nullptr)) {}
+  inline explicit Builder(::capnp::_::StructBuilder base): _builder(base) {}
+  inline operator Reader() const { return Reader(_builder.asReader()); }
+  inline Reader asReader() const { return *this; }
+
+  inline ::capnp::MessageSize totalSize() const { return asReader().totalSize(); }
+#if !CAPNP_LITE
+  inline ::kj::StringTree toString() const { return asReader().toString(); }
+#endif  // !CAPNP_LITE
+
+  inline  ::uint64_t getToken();
+  inline void setToken( ::uint64_t value);
+
+  inline  ::uint64_t getSequence();
+  inline void setSequence( ::uint64_t value);
+
+  inline  ::uint64_t getEpoch();
+  inline void setEpoch( ::uint64_t value);
+
+  inline bool hasEvent();
+  inline  ::netput::rpc::Event::Builder getEvent();
+  inline void setEvent( ::netput::rpc::Event::Reader value);
+  inline  ::netput::rpc::Event::Builder initEvent();
+  inline void adoptEvent(::capnp::Orphan< ::netput::rpc::Event>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::Event> disownEvent();
+
+  inline bool hasParity();
+  inline  ::capnp::Data::Builder getParity();
+  inline void setParity( ::capnp::Data::Reader value);
+  inline  ::capnp::Data::Builder initParity(unsigned int size);
+  inline void adoptParity(::capnp::Orphan< ::capnp::Data>&& value);
+  inline ::capnp::Orphan< ::capnp::Data> disownParity();
+
+private:
+  ::capnp::_::StructBuilder _builder;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+  friend class ::capnp::Orphanage;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::_::PointerHelpers;
+};
+
+#if !CAPNP_LITE
+class Datagram::Pipeline {
+public:
+  typedef Datagram Pipelines;
+
+  inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
+  inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
+      : _typeless(kj::mv(typeless)) {}
+
+  inline  ::netput::rpc::Event::Pipeline getEvent();
+private:
+  ::capnp::AnyPointer::Pipeline _typeless;
+  friend class ::capnp::PipelineHook;
+  template <typename, ::capnp::Kind>
+  friend struct ::capnp::ToDynamic_;
+};
+#endif  // !CAPNP_LITE
+
+class EventBatch::Reader {
+public:
+  typedef EventBatch Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1392,7 +2663,8 @@ public:
   inline bool hasSessionId() const;
   inline  ::capnp::Text::Reader getSessionId() const;
 
-  inline typename Info::Reader getInfo() const;
+  inline bool hasEvents() const;
+  inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Reader getEvents() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -1406,9 +2678,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class Event::Builder {
+class EventBatch::Builder {
 public:
-  typedef Event Builds;
+  typedef EventBatch Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1429,8 +2701,12 @@ public:
   inline void adoptSessionId(::capnp::Orphan< ::capnp::Text>&& value);
   inline ::capnp::Orphan< ::capnp::Text> disownSessionId();
 
-  inline typename Info::Builder getInfo();
-  inline typename Info::Builder initInfo();
+  inline bool hasEvents();
+  inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Builder getEvents();
+  inline void setEvents( ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Reader value);
+  inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Builder initEvents(unsigned int size);
+  inline void adoptEvents(::capnp::Orphan< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>&& value);
+  inline ::capnp::Orphan< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>> disownEvents();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -1442,15 +2718,14 @@ private:
 };
 
 #if !CAPNP_LITE
-class Event::Pipeline {
+class EventBatch::Pipeline {
 public:
-  typedef Event Pipelines;
+  typedef EventBatch Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
-  inline typename Info::Pipeline getInfo();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -1459,9 +2734,9 @@ private:
 };
 #endif  // !CAPNP_LITE
 
-class Event::Info::Reader {
+class LogEntry::Reader {
 public:
-  typedef Info Reads;
+  typedef LogEntry Reads;
 
   Reader() = default;
   inline explicit Reader(::capnp::_::StructReader base): _reader(base) {}
@@ -1476,26 +2751,18 @@ public:
   }
 #endif  // !CAPNP_LITE
 
-  inline Which which() const;
-  inline bool isMouseMotion() const;
-  inline bool hasMouseMotion() const;
-  inline  ::netput::rpc::MouseMotionEvent::Reader getMouseMotion() const;
+  inline  ::netput::rpc::LogEntryKind getKind() const;
 
-  inline bool isMouseButton() const;
-  inline bool hasMouseButton() const;
-  inline  ::netput::rpc::MouseButtonEvent::Reader getMouseButton() const;
+  inline bool hasSession() const;
+  inline  ::capnp::Text::Reader getSession() const;
 
-  inline bool isMouseWheel() const;
-  inline bool hasMouseWheel() const;
-  inline  ::netput::rpc::MouseWheelEvent::Reader getMouseWheel() const;
+  inline  ::uint64_t getReceiveTime() const;
 
-  inline bool isKeyboard() const;
-  inline bool hasKeyboard() const;
-  inline  ::netput::rpc::KeyboardEvent::Reader getKeyboard() const;
+  inline bool hasEvent() const;
+  inline  ::netput::rpc::Event::Reader getEvent() const;
 
-  inline bool isWindow() const;
-  inline bool hasWindow() const;
-  inline  ::netput::rpc::WindowEvent::Reader getWindow() const;
+  inline bool hasUserData() const;
+  inline  ::capnp::Data::Reader getUserData() const;
 
 private:
   ::capnp::_::StructReader _reader;
@@ -1509,9 +2776,9 @@ private:
   friend class ::capnp::Orphanage;
 };
 
-class Event::Info::Builder {
+class LogEntry::Builder {
 public:
-  typedef Info Builds;
+  typedef LogEntry Builds;
 
   Builder() = delete;  // Deleted to discourage incorrect usage.
                        // You can explicitly initialize to nullptr instead.
@@ -1525,46 +2792,32 @@ public:
   inline ::kj::StringTree toString() const { return asReader().toString(); }
 #endif  // !CAPNP_LITE
 
-  inline Which which();
-  inline bool isMouseMotion();
-  inline bool hasMouseMotion();
-  inline  ::netput::rpc::MouseMotionEvent::Builder getMouseMotion();
-  inline void setMouseMotion( ::netput::rpc::MouseMotionEvent::Reader value);
-  inline  ::netput::rpc::MouseMotionEvent::Builder initMouseMotion();
-  inline void adoptMouseMotion(::capnp::Orphan< ::netput::rpc::MouseMotionEvent>&& value);
-  inline ::capnp::Orphan< ::netput::rpc::MouseMotionEvent> disownMouseMotion();
+  inline  ::netput::rpc::LogEntryKind getKind();
+  inline void setKind( ::netput::rpc::LogEntryKind value);
 
-  inline bool isMouseButton();
-  inline bool hasMouseButton();
-  inline  ::netput::rpc::MouseButtonEvent::Builder getMouseButton();
-  inline void setMouseButton( ::netput::rpc::MouseButtonEvent::Reader value);
-  inline  ::netput::rpc::MouseButtonEvent::Builder initMouseButton();
-  inline void adoptMouseButton(::capnp::Orphan< ::netput::rpc::MouseButtonEvent>&& value);
-  inline ::capnp::Orphan< ::netput::rpc::MouseButtonEvent> disownMouseButton();
+  inline bool hasSession();
+  inline  ::capnp::Text::Builder getSession();
+  inline void setSession( ::capnp::Text::Reader value);
+  inline  ::capnp::Text::Builder initSession(unsigned int size);
+  inline void adoptSession(::capnp::Orphan< ::capnp::Text>&& value);
+  inline ::capnp::Orphan< ::capnp::Text> disownSession();
 
-  inline bool isMouseWheel();
-  inline bool hasMouseWheel();
-  inline  ::netput::rpc::MouseWheelEvent::Builder getMouseWheel();
-  inline void setMouseWheel( ::netput::rpc::MouseWheelEvent::Reader value);
-  inline  ::netput::rpc::MouseWheelEvent::Builder initMouseWheel();
-  inline void adoptMouseWheel(::capnp::Orphan< ::netput::rpc::MouseWheelEvent>&& value);
-  inline ::capnp::Orphan< ::netput::rpc::MouseWheelEvent> disownMouseWheel();
+  inline  ::uint64_t getReceiveTime();
+  inline void setReceiveTime( ::uint64_t value);
 
-  inline bool isKeyboard();
-  inline bool hasKeyboard();
-  inline  ::netput::rpc::KeyboardEvent::Builder getKeyboard();
-  inline void setKeyboard( ::netput::rpc::KeyboardEvent::Reader value);
-  inline  ::netput::rpc::KeyboardEvent::Builder initKeyboard();
-  inline void adoptKeyboard(::capnp::Orphan< ::netput::rpc::KeyboardEvent>&& value);
-  inline ::capnp::Orphan< ::netput::rpc::KeyboardEvent> disownKeyboard();
+  inline bool hasEvent();
+  inline  ::netput::rpc::Event::Builder getEvent();
+  inline void setEvent( ::netput::rpc::Event::Reader value);
+  inline  ::netput::rpc::Event::Builder initEvent();
+  inline void adoptEvent(::capnp::Orphan< ::netput::rpc::Event>&& value);
+  inline ::capnp::Orphan< ::netput::rpc::Event> disownEvent();
 
-  inline bool isWindow();
-  inline bool hasWindow();
-  inline  ::netput::rpc::WindowEvent::Builder getWindow();
-  inline void setWindow( ::netput::rpc::WindowEvent::Reader value);
-  inline  ::netput::rpc::WindowEvent::Builder initWindow();
-  inline void adoptWindow(::capnp::Orphan< ::netput::rpc::WindowEvent>&& value);
-  inline ::capnp::Orphan< ::netput::rpc::WindowEvent> disownWindow();
+  inline bool hasUserData();
+  inline  ::capnp::Data::Builder getUserData();
+  inline void setUserData( ::capnp::Data::Reader value);
+  inline  ::capnp::Data::Builder initUserData(unsigned int size);
+  inline void adoptUserData(::capnp::Orphan< ::capnp::Data>&& value);
+  inline ::capnp::Orphan< ::capnp::Data> disownUserData();
 
 private:
   ::capnp::_::StructBuilder _builder;
@@ -1576,14 +2829,15 @@ private:
 };
 
 #if !CAPNP_LITE
-class Event::Info::Pipeline {
+class LogEntry::Pipeline {
 public:
-  typedef Info Pipelines;
+  typedef LogEntry Pipelines;
 
   inline Pipeline(decltype(nullptr)): _typeless(nullptr) {}
   inline explicit Pipeline(::capnp::AnyPointer::Pipeline&& typeless)
       : _typeless(kj::mv(typeless)) {}
 
+  inline  ::netput::rpc::Event::Pipeline getEvent();
 private:
   ::capnp::AnyPointer::Pipeline _typeless;
   friend class ::capnp::PipelineHook;
@@ -1624,6 +2878,8 @@ public:
 
   inline  ::int32_t getRelativeY() const;
 
+  inline  ::uint8_t getButtons() const;
+
 private:
   ::capnp::_::StructReader _reader;
   template <typename, ::capnp::Kind>
@@ -1677,6 +2933,9 @@ public:
   inline  ::int32_t getRelativeY();
   inline void setRelativeY( ::int32_t value);
 
+  inline  ::uint8_t getButtons();
+  inline void setButtons( ::uint8_t value);
+
 private:
   ::capnp::_::StructBuilder _builder;
   template <typename, ::capnp::Kind>
@@ -2420,6 +3679,220 @@ inline ::capnp::Orphan< ::netput::rpc::DisconnectResponse> Netput::DisconnectRes
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 
+inline bool Netput::PushBatchParams::Reader::hasBatch() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool Netput::PushBatchParams::Builder::hasBatch() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::netput::rpc::EventBatch::Reader Netput::PushBatchParams::Reader::getBatch() const {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::EventBatch>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::netput::rpc::EventBatch::Builder Netput::PushBatchParams::Builder::getBatch() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::EventBatch>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::netput::rpc::EventBatch::Pipeline Netput::PushBatchParams::Pipeline::getBatch() {
+  return  ::netput::rpc::EventBatch::Pipeline(_typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void Netput::PushBatchParams::Builder::setBatch( ::netput::rpc::EventBatch::Reader value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::EventBatch>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::netput::rpc::EventBatch::Builder Netput::PushBatchParams::Builder::initBatch() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::EventBatch>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void Netput::PushBatchParams::Builder::adoptBatch(
+    ::capnp::Orphan< ::netput::rpc::EventBatch>&& value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::EventBatch>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::netput::rpc::EventBatch> Netput::PushBatchParams::Builder::disownBatch() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::EventBatch>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool Netput::PushStreamParams::Reader::hasEvent() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool Netput::PushStreamParams::Builder::hasEvent() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::netput::rpc::Event::Reader Netput::PushStreamParams::Reader::getEvent() const {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::netput::rpc::Event::Builder Netput::PushStreamParams::Builder::getEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::netput::rpc::Event::Pipeline Netput::PushStreamParams::Pipeline::getEvent() {
+  return  ::netput::rpc::Event::Pipeline(_typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void Netput::PushStreamParams::Builder::setEvent( ::netput::rpc::Event::Reader value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Event>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::netput::rpc::Event::Builder Netput::PushStreamParams::Builder::initEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void Netput::PushStreamParams::Builder::adoptEvent(
+    ::capnp::Orphan< ::netput::rpc::Event>&& value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Event>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::netput::rpc::Event> Netput::PushStreamParams::Builder::disownEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+#if !CAPNP_LITE
+inline Session::Client::Client(decltype(nullptr))
+    : ::capnp::Capability::Client(nullptr) {}
+inline Session::Client::Client(
+    ::kj::Own< ::capnp::ClientHook>&& hook)
+    : ::capnp::Capability::Client(::kj::mv(hook)) {}
+template <typename _t, typename>
+inline Session::Client::Client(::kj::Own<_t>&& server)
+    : ::capnp::Capability::Client(::kj::mv(server)) {}
+template <typename _t, typename>
+inline Session::Client::Client(::kj::Promise<_t>&& promise)
+    : ::capnp::Capability::Client(::kj::mv(promise)) {}
+inline Session::Client::Client(::kj::Exception&& exception)
+    : ::capnp::Capability::Client(::kj::mv(exception)) {}
+inline  ::netput::rpc::Session::Client& Session::Client::operator=(Client& other) {
+  ::capnp::Capability::Client::operator=(other);
+  return *this;
+}
+inline  ::netput::rpc::Session::Client& Session::Client::operator=(Client&& other) {
+  ::capnp::Capability::Client::operator=(kj::mv(other));
+  return *this;
+}
+
+#endif  // !CAPNP_LITE
+inline bool Session::PushParams::Reader::hasEvent() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool Session::PushParams::Builder::hasEvent() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::netput::rpc::Event::Reader Session::PushParams::Reader::getEvent() const {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::netput::rpc::Event::Builder Session::PushParams::Builder::getEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::netput::rpc::Event::Pipeline Session::PushParams::Pipeline::getEvent() {
+  return  ::netput::rpc::Event::Pipeline(_typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void Session::PushParams::Builder::setEvent( ::netput::rpc::Event::Reader value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Event>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::netput::rpc::Event::Builder Session::PushParams::Builder::initEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void Session::PushParams::Builder::adoptEvent(
+    ::capnp::Orphan< ::netput::rpc::Event>&& value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Event>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::netput::rpc::Event> Session::PushParams::Builder::disownEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool Session::PushBatchParams::Reader::hasEvents() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool Session::PushBatchParams::Builder::hasEvents() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Reader Session::PushBatchParams::Reader::getEvents() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Builder Session::PushBatchParams::Builder::getEvents() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void Session::PushBatchParams::Builder::setEvents( ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Builder Session::PushBatchParams::Builder::initEvents(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), size);
+}
+inline void Session::PushBatchParams::Builder::adoptEvents(
+    ::capnp::Orphan< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>> Session::PushBatchParams::Builder::disownEvents() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool Session::PushStreamParams::Reader::hasEvent() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool Session::PushStreamParams::Builder::hasEvent() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::netput::rpc::Event::Reader Session::PushStreamParams::Reader::getEvent() const {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::netput::rpc::Event::Builder Session::PushStreamParams::Builder::getEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::netput::rpc::Event::Pipeline Session::PushStreamParams::Pipeline::getEvent() {
+  return  ::netput::rpc::Event::Pipeline(_typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void Session::PushStreamParams::Builder::setEvent( ::netput::rpc::Event::Reader value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Event>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::netput::rpc::Event::Builder Session::PushStreamParams::Builder::initEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void Session::PushStreamParams::Builder::adoptEvent(
+    ::capnp::Orphan< ::netput::rpc::Event>&& value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Event>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::netput::rpc::Event> Session::PushStreamParams::Builder::disownEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
 inline bool ConnectRequest::Reader::hasUserData() const {
   return !_reader.getPointerField(
       ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
@@ -2454,22 +3927,117 @@ inline ::capnp::Orphan< ::capnp::Data> ConnectRequest::Builder::disownUserData()
       ::capnp::bounded<0>() * ::capnp::POINTERS));
 }
 
-inline typename ConnectResponse::Message::Reader ConnectResponse::Reader::getMessage() const {
-  return typename ConnectResponse::Message::Reader(_reader);
+inline bool ConnectRequest::Reader::getDatagrams() const {
+  return _reader.getDataField<bool>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline bool ConnectRequest::Builder::getDatagrams() {
+  return _builder.getDataField<bool>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void ConnectRequest::Builder::setDatagrams(bool value) {
+  _builder.setDataField<bool>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline  ::uint8_t ConnectRequest::Reader::getParityGroup() const {
+  return _reader.getDataField< ::uint8_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline  ::uint8_t ConnectRequest::Builder::getParityGroup() {
+  return _builder.getDataField< ::uint8_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void ConnectRequest::Builder::setParityGroup( ::uint8_t value) {
+  _builder.setDataField< ::uint8_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline typename ConnectResponse::Message::Reader ConnectResponse::Reader::getMessage() const {
+  return typename ConnectResponse::Message::Reader(_reader);
+}
+inline typename ConnectResponse::Message::Builder ConnectResponse::Builder::getMessage() {
+  return typename ConnectResponse::Message::Builder(_builder);
+}
+#if !CAPNP_LITE
+inline typename ConnectResponse::Message::Pipeline ConnectResponse::Pipeline::getMessage() {
+  return typename ConnectResponse::Message::Pipeline(_typeless.noop());
+}
+#endif  // !CAPNP_LITE
+inline typename ConnectResponse::Message::Builder ConnectResponse::Builder::initMessage() {
+  _builder.setDataField< ::uint16_t>(::capnp::bounded<0>() * ::capnp::ELEMENTS, 0);
+  _builder.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS).clear();
+  return typename ConnectResponse::Message::Builder(_builder);
+}
+inline bool ConnectResponse::Reader::hasSession() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline bool ConnectResponse::Builder::hasSession() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+#if !CAPNP_LITE
+inline  ::netput::rpc::Session::Client ConnectResponse::Reader::getSession() const {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Session>::get(_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::netput::rpc::Session::Client ConnectResponse::Builder::getSession() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Session>::get(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::netput::rpc::Session::Client ConnectResponse::Pipeline::getSession() {
+  return  ::netput::rpc::Session::Client(_typeless.getPointerField(1).asCap());
+}
+inline void ConnectResponse::Builder::setSession( ::netput::rpc::Session::Client&& cap) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Session>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(cap));
+}
+inline void ConnectResponse::Builder::setSession( ::netput::rpc::Session::Client& cap) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Session>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), cap);
+}
+inline void ConnectResponse::Builder::adoptSession(
+    ::capnp::Orphan< ::netput::rpc::Session>&& value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Session>::adopt(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::netput::rpc::Session> ConnectResponse::Builder::disownSession() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Session>::disown(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+#endif  // !CAPNP_LITE
+
+inline  ::uint16_t ConnectResponse::Reader::getDatagramPort() const {
+  return _reader.getDataField< ::uint16_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline  ::uint16_t ConnectResponse::Builder::getDatagramPort() {
+  return _builder.getDataField< ::uint16_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
 }
-inline typename ConnectResponse::Message::Builder ConnectResponse::Builder::getMessage() {
-  return typename ConnectResponse::Message::Builder(_builder);
+inline void ConnectResponse::Builder::setDatagramPort( ::uint16_t value) {
+  _builder.setDataField< ::uint16_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
 }
-#if !CAPNP_LITE
-inline typename ConnectResponse::Message::Pipeline ConnectResponse::Pipeline::getMessage() {
-  return typename ConnectResponse::Message::Pipeline(_typeless.noop());
+
+inline  ::uint64_t ConnectResponse::Reader::getDatagramToken() const {
+  return _reader.getDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
 }
-#endif  // !CAPNP_LITE
-inline typename ConnectResponse::Message::Builder ConnectResponse::Builder::initMessage() {
-  _builder.setDataField< ::uint16_t>(::capnp::bounded<0>() * ::capnp::ELEMENTS, 0);
-  _builder.getPointerField(::capnp::bounded<0>() * ::capnp::POINTERS).clear();
-  return typename ConnectResponse::Message::Builder(_builder);
+
+inline  ::uint64_t ConnectResponse::Builder::getDatagramToken() {
+  return _builder.getDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void ConnectResponse::Builder::setDatagramToken( ::uint64_t value) {
+  _builder.setDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
 }
+
 inline  ::netput::rpc::ConnectResponse::Message::Which ConnectResponse::Message::Reader::which() const {
   return _reader.getDataField<Which>(
       ::capnp::bounded<0>() * ::capnp::ELEMENTS);
@@ -2984,6 +4552,324 @@ inline ::capnp::Orphan< ::netput::rpc::WindowEvent> Event::Info::Builder::disown
       ::capnp::bounded<1>() * ::capnp::POINTERS));
 }
 
+inline  ::uint64_t Datagram::Reader::getToken() const {
+  return _reader.getDataField< ::uint64_t>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline  ::uint64_t Datagram::Builder::getToken() {
+  return _builder.getDataField< ::uint64_t>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void Datagram::Builder::setToken( ::uint64_t value) {
+  _builder.setDataField< ::uint64_t>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline  ::uint64_t Datagram::Reader::getSequence() const {
+  return _reader.getDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline  ::uint64_t Datagram::Builder::getSequence() {
+  return _builder.getDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void Datagram::Builder::setSequence( ::uint64_t value) {
+  _builder.setDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline  ::uint64_t Datagram::Reader::getEpoch() const {
+  return _reader.getDataField< ::uint64_t>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS);
+}
+
+inline  ::uint64_t Datagram::Builder::getEpoch() {
+  return _builder.getDataField< ::uint64_t>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS);
+}
+inline void Datagram::Builder::setEpoch( ::uint64_t value) {
+  _builder.setDataField< ::uint64_t>(
+      ::capnp::bounded<2>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool Datagram::Reader::hasEvent() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool Datagram::Builder::hasEvent() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::netput::rpc::Event::Reader Datagram::Reader::getEvent() const {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::netput::rpc::Event::Builder Datagram::Builder::getEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::netput::rpc::Event::Pipeline Datagram::Pipeline::getEvent() {
+  return  ::netput::rpc::Event::Pipeline(_typeless.getPointerField(0));
+}
+#endif  // !CAPNP_LITE
+inline void Datagram::Builder::setEvent( ::netput::rpc::Event::Reader value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Event>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::netput::rpc::Event::Builder Datagram::Builder::initEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void Datagram::Builder::adoptEvent(
+    ::capnp::Orphan< ::netput::rpc::Event>&& value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Event>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::netput::rpc::Event> Datagram::Builder::disownEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool Datagram::Reader::hasParity() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline bool Datagram::Builder::hasParity() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::Data::Reader Datagram::Reader::getParity() const {
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::get(_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::capnp::Data::Builder Datagram::Builder::getParity() {
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::get(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline void Datagram::Builder::setParity( ::capnp::Data::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::Data>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Data::Builder Datagram::Builder::initParity(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::init(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), size);
+}
+inline void Datagram::Builder::adoptParity(
+    ::capnp::Orphan< ::capnp::Data>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::Data>::adopt(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Data> Datagram::Builder::disownParity() {
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::disown(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+
+inline bool EventBatch::Reader::hasSessionId() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool EventBatch::Builder::hasSessionId() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::Text::Reader EventBatch::Reader::getSessionId() const {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::capnp::Text::Builder EventBatch::Builder::getSessionId() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void EventBatch::Builder::setSessionId( ::capnp::Text::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Text::Builder EventBatch::Builder::initSessionId(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), size);
+}
+inline void EventBatch::Builder::adoptSessionId(
+    ::capnp::Orphan< ::capnp::Text>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Text> EventBatch::Builder::disownSessionId() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline bool EventBatch::Reader::hasEvents() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline bool EventBatch::Builder::hasEvents() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Reader EventBatch::Reader::getEvents() const {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::get(_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Builder EventBatch::Builder::getEvents() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::get(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline void EventBatch::Builder::setEvents( ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>::Builder EventBatch::Builder::initEvents(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::init(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), size);
+}
+inline void EventBatch::Builder::adoptEvents(
+    ::capnp::Orphan< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::adopt(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>> EventBatch::Builder::disownEvents() {
+  return ::capnp::_::PointerHelpers< ::capnp::List< ::netput::rpc::Event,  ::capnp::Kind::STRUCT>>::disown(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+
+inline  ::netput::rpc::LogEntryKind LogEntry::Reader::getKind() const {
+  return _reader.getDataField< ::netput::rpc::LogEntryKind>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+
+inline  ::netput::rpc::LogEntryKind LogEntry::Builder::getKind() {
+  return _builder.getDataField< ::netput::rpc::LogEntryKind>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS);
+}
+inline void LogEntry::Builder::setKind( ::netput::rpc::LogEntryKind value) {
+  _builder.setDataField< ::netput::rpc::LogEntryKind>(
+      ::capnp::bounded<0>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool LogEntry::Reader::hasSession() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline bool LogEntry::Builder::hasSession() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::Text::Reader LogEntry::Reader::getSession() const {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_reader.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline  ::capnp::Text::Builder LogEntry::Builder::getSession() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::get(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+inline void LogEntry::Builder::setSession( ::capnp::Text::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::set(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Text::Builder LogEntry::Builder::initSession(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::init(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), size);
+}
+inline void LogEntry::Builder::adoptSession(
+    ::capnp::Orphan< ::capnp::Text>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::Text>::adopt(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Text> LogEntry::Builder::disownSession() {
+  return ::capnp::_::PointerHelpers< ::capnp::Text>::disown(_builder.getPointerField(
+      ::capnp::bounded<0>() * ::capnp::POINTERS));
+}
+
+inline  ::uint64_t LogEntry::Reader::getReceiveTime() const {
+  return _reader.getDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+
+inline  ::uint64_t LogEntry::Builder::getReceiveTime() {
+  return _builder.getDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS);
+}
+inline void LogEntry::Builder::setReceiveTime( ::uint64_t value) {
+  _builder.setDataField< ::uint64_t>(
+      ::capnp::bounded<1>() * ::capnp::ELEMENTS, value);
+}
+
+inline bool LogEntry::Reader::hasEvent() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline bool LogEntry::Builder::hasEvent() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS).isNull();
+}
+inline  ::netput::rpc::Event::Reader LogEntry::Reader::getEvent() const {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::get(_reader.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline  ::netput::rpc::Event::Builder LogEntry::Builder::getEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::get(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+#if !CAPNP_LITE
+inline  ::netput::rpc::Event::Pipeline LogEntry::Pipeline::getEvent() {
+  return  ::netput::rpc::Event::Pipeline(_typeless.getPointerField(1));
+}
+#endif  // !CAPNP_LITE
+inline void LogEntry::Builder::setEvent( ::netput::rpc::Event::Reader value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Event>::set(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), value);
+}
+inline  ::netput::rpc::Event::Builder LogEntry::Builder::initEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::init(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+inline void LogEntry::Builder::adoptEvent(
+    ::capnp::Orphan< ::netput::rpc::Event>&& value) {
+  ::capnp::_::PointerHelpers< ::netput::rpc::Event>::adopt(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::netput::rpc::Event> LogEntry::Builder::disownEvent() {
+  return ::capnp::_::PointerHelpers< ::netput::rpc::Event>::disown(_builder.getPointerField(
+      ::capnp::bounded<1>() * ::capnp::POINTERS));
+}
+
+inline bool LogEntry::Reader::hasUserData() const {
+  return !_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline bool LogEntry::Builder::hasUserData() {
+  return !_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS).isNull();
+}
+inline  ::capnp::Data::Reader LogEntry::Reader::getUserData() const {
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::get(_reader.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline  ::capnp::Data::Builder LogEntry::Builder::getUserData() {
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::get(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+inline void LogEntry::Builder::setUserData( ::capnp::Data::Reader value) {
+  ::capnp::_::PointerHelpers< ::capnp::Data>::set(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), value);
+}
+inline  ::capnp::Data::Builder LogEntry::Builder::initUserData(unsigned int size) {
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::init(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), size);
+}
+inline void LogEntry::Builder::adoptUserData(
+    ::capnp::Orphan< ::capnp::Data>&& value) {
+  ::capnp::_::PointerHelpers< ::capnp::Data>::adopt(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS), kj::mv(value));
+}
+inline ::capnp::Orphan< ::capnp::Data> LogEntry::Builder::disownUserData() {
+  return ::capnp::_::PointerHelpers< ::capnp::Data>::disown(_builder.getPointerField(
+      ::capnp::bounded<2>() * ::capnp::POINTERS));
+}
+
 inline  ::uint64_t MouseMotionEvent::Reader::getTimestamp() const {
   return _reader.getDataField< ::uint64_t>(
       ::capnp::bounded<0>() * ::capnp::ELEMENTS);
@@ -3107,6 +4993,20 @@ inline void MouseMotionEvent::Builder::setRelativeY( ::int32_t value) {
       ::capnp::bounded<6>() * ::capnp::ELEMENTS, value);
 }
 
+inline  ::uint8_t MouseMotionEvent::Reader::getButtons() const {
+  return _reader.getDataField< ::uint8_t>(
+      ::capnp::bounded<28>() * ::capnp::ELEMENTS);
+}
+
+inline  ::uint8_t MouseMotionEvent::Builder::getButtons() {
+  return _builder.getDataField< ::uint8_t>(
+      ::capnp::bounded<28>() * ::capnp::ELEMENTS);
+}
+inline void MouseMotionEvent::Builder::setButtons( ::uint8_t value) {
+  _builder.setDataField< ::uint8_t>(
+      ::capnp::bounded<28>() * ::capnp::ELEMENTS, value);
+}
+
 inline  ::netput::rpc::InputState MouseMotionEvent::MouseStateMask::Reader::getLeft() const {
   return _reader.getDataField< ::netput::rpc::InputState>(
       ::capnp::bounded<0>() * ::capnp::ELEMENTS);
@@ -3,15 +3,48 @@
 
 #ifdef _WIN32
 #pragma comment(lib,"WS2_32.lib")
+#else
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <signal.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
 #endif
 
 #include <capnp/ez-rpc.h>
 #include <capnp/message.h>
+#include <capnp/serialize.h>
 #include <kj/async.h>
+#include <kj/async-io.h>
 
+#include <algorithm>
+#include <atomic>
+#include <bitset>
+#include <chrono>
+#include <condition_variable>
+#include <cerrno>
+#include <cstring>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <fstream>
 #include <functional>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <new>
+#include <random>
 #include <sstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
 
 static std::string make_address(const std::string &host, uint16_t port)
 {
@@ -20,6 +53,67 @@ static std::string make_address(const std::string &host, uint16_t port)
     return address.str();
 }
 
+static bool is_shm_address(const std::string &address)
+{
+    return address.compare(0, 4, "shm:") == 0;
+}
+
+static bool is_unix_address(const std::string &address)
+{
+    return address.compare(0, 5, "unix:") == 0;
+}
+
+// "host:port" to "host", brackets of an ipv6 literal are kept for kj to parse
+static std::string address_host(const std::string &address)
+{
+    const size_t separator = address.rfind(':');
+    return (separator == std::string::npos || address.back() == ']') ? address : address.substr(0, separator);
+}
+
+// a name can resolve to several addresses, pinning the first keeps every datagram on one route
+static kj::Promise<kj::Own<kj::NetworkAddress>> resolve_datagram_address(kj::Network &network, const std::string &host, uint16_t port)
+{
+    return network.parseAddress(host.c_str(), port).then(
+        [&network](kj::Own<kj::NetworkAddress> &&resolved)
+        {
+            const std::string addresses = resolved->toString().cStr();
+            return network.parseAddress(addresses.substr(0, addresses.find(',')).c_str());
+        });
+}
+
+// a unix socket left behind by a previous server would make the bind fail, only ever removes sockets
+// and only once a connect is refused, so a server still listening there keeps its socket and the
+// bind fails instead
+static void remove_stale_socket(const std::string &address)
+{
+#ifndef _WIN32
+    struct stat status;
+    struct sockaddr_un peer;
+    int probe;
+    bool refused;
+    if (is_unix_address(address))
+    {
+        const std::string path = address.substr(5);
+        if (path.size() < sizeof(peer.sun_path) && stat(path.c_str(), &status) == 0 && S_ISSOCK(status.st_mode))
+        {
+            std::memset(&peer, 0, sizeof(peer));
+            peer.sun_family = AF_UNIX;
+            std::memcpy(peer.sun_path, path.c_str(), path.size() + 1);
+            probe = socket(AF_UNIX, SOCK_STREAM, 0);
+            refused = probe >= 0 && connect(probe, reinterpret_cast<const struct sockaddr *>(&peer), sizeof(peer)) != 0 && errno == ECONNREFUSED;
+            if (probe >= 0)
+            {
+                close(probe);
+            }
+            if (refused)
+            {
+                unlink(path.c_str());
+            }
+        }
+    }
+#endif
+}
+
 namespace netput
 {
     static input_state input_state_from_rpc(rpc::InputState state)
@@ -82,379 +176,3547 @@ namespace netput
 
     static window_event window_event_from_rpc(rpc::WindowEventType event)
     {
-        const std::unordered_map<rpc::WindowEventType, window_event> map = {
-            {rpc::WindowEventType::SHOWN_TYPE, window_event::shown},
-            {rpc::WindowEventType::HIDDEN_TYPE, window_event::hidden},
-            {rpc::WindowEventType::EXPOSED_TYPE, window_event::exposed},
-            {rpc::WindowEventType::MOVED_TYPE, window_event::moved},
-            {rpc::WindowEventType::RESIZED_TYPE, window_event::resized},
-            {rpc::WindowEventType::MINIMIZED_TYPE, window_event::minimized},
-            {rpc::WindowEventType::MAXIMIZED_TYPE, window_event::maximized},
-            {rpc::WindowEventType::RESTORED_TYPE, window_event::restored},
-            {rpc::WindowEventType::MOUSE_ENTER_TYPE, window_event::mouse_enter},
-            {rpc::WindowEventType::MOUSE_LEAVE_TYPE, window_event::mouse_leave},
-            {rpc::WindowEventType::FOCUS_GAINED_TYPE, window_event::focus_gained},
-            {rpc::WindowEventType::FOCUS_LOST_TYPE, window_event::focus_lost},
-        };
-        return map.at(event);
+        window_event result;
+        switch (event)
+        {
+        case rpc::WindowEventType::SHOWN_TYPE:
+            result = window_event::shown;
+            break;
+        case rpc::WindowEventType::HIDDEN_TYPE:
+            result = window_event::hidden;
+            break;
+        case rpc::WindowEventType::EXPOSED_TYPE:
+            result = window_event::exposed;
+            break;
+        case rpc::WindowEventType::MOVED_TYPE:
+            result = window_event::moved;
+            break;
+        case rpc::WindowEventType::RESIZED_TYPE:
+            result = window_event::resized;
+            break;
+        case rpc::WindowEventType::MINIMIZED_TYPE:
+            result = window_event::minimized;
+            break;
+        case rpc::WindowEventType::MAXIMIZED_TYPE:
+            result = window_event::maximized;
+            break;
+        case rpc::WindowEventType::RESTORED_TYPE:
+            result = window_event::restored;
+            break;
+        case rpc::WindowEventType::MOUSE_ENTER_TYPE:
+            result = window_event::mouse_enter;
+            break;
+        case rpc::WindowEventType::MOUSE_LEAVE_TYPE:
+            result = window_event::mouse_leave;
+            break;
+        case rpc::WindowEventType::FOCUS_GAINED_TYPE:
+            result = window_event::focus_gained;
+            break;
+        case rpc::WindowEventType::FOCUS_LOST_TYPE:
+            result = window_event::focus_lost;
+            break;
+        default:
+            throw std::out_of_range("unknown window event type");
+        }
+        return result;
     }
 
     static rpc::WindowEventType window_event_to_rpc(window_event event)
     {
-        const std::unordered_map<window_event, rpc::WindowEventType> map = {
-            {window_event::shown, rpc::WindowEventType::SHOWN_TYPE},
-            {window_event::hidden, rpc::WindowEventType::HIDDEN_TYPE},
-            {window_event::exposed, rpc::WindowEventType::EXPOSED_TYPE},
-            {window_event::moved, rpc::WindowEventType::MOVED_TYPE},
-            {window_event::resized, rpc::WindowEventType::RESIZED_TYPE},
-            {window_event::minimized, rpc::WindowEventType::MINIMIZED_TYPE},
-            {window_event::maximized, rpc::WindowEventType::MAXIMIZED_TYPE},
-            {window_event::restored, rpc::WindowEventType::RESTORED_TYPE},
-            {window_event::mouse_enter, rpc::WindowEventType::MOUSE_ENTER_TYPE},
-            {window_event::mouse_leave, rpc::WindowEventType::MOUSE_LEAVE_TYPE},
-            {window_event::focus_gained, rpc::WindowEventType::FOCUS_GAINED_TYPE},
-            {window_event::focus_lost, rpc::WindowEventType::FOCUS_LOST_TYPE},
-        };
-        return map.at(event);
+        rpc::WindowEventType result;
+        switch (event)
+        {
+        case window_event::shown:
+            result = rpc::WindowEventType::SHOWN_TYPE;
+            break;
+        case window_event::hidden:
+            result = rpc::WindowEventType::HIDDEN_TYPE;
+            break;
+        case window_event::exposed:
+            result = rpc::WindowEventType::EXPOSED_TYPE;
+            break;
+        case window_event::moved:
+            result = rpc::WindowEventType::MOVED_TYPE;
+            break;
+        case window_event::resized:
+            result = rpc::WindowEventType::RESIZED_TYPE;
+            break;
+        case window_event::minimized:
+            result = rpc::WindowEventType::MINIMIZED_TYPE;
+            break;
+        case window_event::maximized:
+            result = rpc::WindowEventType::MAXIMIZED_TYPE;
+            break;
+        case window_event::restored:
+            result = rpc::WindowEventType::RESTORED_TYPE;
+            break;
+        case window_event::mouse_enter:
+            result = rpc::WindowEventType::MOUSE_ENTER_TYPE;
+            break;
+        case window_event::mouse_leave:
+            result = rpc::WindowEventType::MOUSE_LEAVE_TYPE;
+            break;
+        case window_event::focus_gained:
+            result = rpc::WindowEventType::FOCUS_GAINED_TYPE;
+            break;
+        case window_event::focus_lost:
+            result = rpc::WindowEventType::FOCUS_LOST_TYPE;
+            break;
+        default:
+            throw std::out_of_range("unknown window event type");
+        }
+        return result;
     }
 
     namespace internal
     {
-        class client
+        // bounded multi-producer queue (Vyukov), producers never take a lock or make a syscall
+        template <typename T>
+        class mpsc_queue
         {
         public:
-            client(const std::string &address)
-            {
-                _rpc_client = std::make_unique<capnp::EzRpcClient>(address);
-                _main = std::make_unique<netput::rpc::Netput::Client>(_rpc_client->getMain<netput::rpc::Netput::Client>());
-            }
-
-            ~client() = default;
-
-            client(const client &copy) = delete;
-
-            client(client &&move) = default;
-
-            void connect(const uint8_t *buffer, size_t size)
+            mpsc_queue(size_t capacity)
             {
-                auto request = _main->connectRequest();
-                auto builder = request.initRequest();
-                auto user_data_builder = builder.initUserData(size);
-                if (size > 0)
-                {
-                    std::memcpy(user_data_builder.begin(), buffer, size);
-                }
-                auto promise = request.send();
-                auto reader = promise.wait(_rpc_client->getWaitScope());
-                if (!reader.hasResponse())
+                size_t size;
+                size = 2;
+                while (size < capacity)
                 {
-                    throw std::runtime_error("failed to read response from server");
+                    size <<= 1;
                 }
-                auto response = reader.getResponse();
-                auto message = response.getMessage();
-                if (message.isError())
+                _cells = std::make_unique<cell[]>(size);
+                _mask = size - 1;
+                for (size_t index = 0; index < size; index++)
                 {
-                    throw std::runtime_error(std::string("error returned from server: ") + message.getError().cStr());
+                    _cells[index].sequence.store(index, std::memory_order_relaxed);
                 }
-
-                _session_id = message.getSessionId();
+                _enqueue_position.store(0, std::memory_order_relaxed);
+                _dequeue_position = 0;
             }
 
-            void disconnect()
+            bool try_push(const T &value)
             {
-                auto request = _main->disconnectRequest();
-                auto builder = request.initRequest();
-                builder.setSessionId(_session_id);
-                auto promise = request.send();
-                auto reader = promise.wait(_rpc_client->getWaitScope());
-                if (reader.hasResponse() && reader.getResponse().hasError())
+                cell *target;
+                size_t position;
+                size_t sequence;
+                intptr_t difference;
+
+                position = _enqueue_position.load(std::memory_order_relaxed);
+                while (true)
                 {
-                    throw std::runtime_error(std::string("error returned from server: ") + reader.getResponse().getError().cStr());
+                    target = &_cells[position & _mask];
+                    sequence = target->sequence.load(std::memory_order_acquire);
+                    difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+                    if (difference == 0)
+                    {
+                        if (_enqueue_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                        {
+                            break;
+                        }
+                    }
+                    else if (difference < 0)
+                    {
+                        return false;
+                    }
+                    else
+                    {
+                        position = _enqueue_position.load(std::memory_order_relaxed);
+                    }
                 }
+                target->value = value;
+                target->sequence.store(position + 1, std::memory_order_release);
+                return true;
             }
 
-            void push(const std::function<void(netput::rpc::Event::Info::Builder &)> &build_function)
-            {
-                auto request = _main->pushRequest();
-                auto builder = request.initEvent();
-                builder.setSessionId(_session_id);
-                auto info_builder = builder.initInfo();
-                build_function(info_builder);
-                auto promise = request.send();
-                promise.wait(_rpc_client->getWaitScope());
-            }
-
-            void send_keyboard(uint64_t timestamp, uint32_t window_id, input_state state, bool repeat, uint32_t key_code)
+            // single consumer only
+            bool empty() const
             {
-                const std::function<void(netput::rpc::Event::Info::Builder &)> &build_function = [&](netput::rpc::Event::Info::Builder &builder)
-                {
-                    auto keyboard_builder = builder.initKeyboard();
-                    keyboard_builder.setTimestamp(timestamp);
-                    keyboard_builder.setWindowId(window_id);
-                    keyboard_builder.setState(input_state_to_rpc(state));
-                    keyboard_builder.setRepeat(repeat);
-                    keyboard_builder.setKeyCode(key_code);
-                };
-                push(build_function);
-            }
-
-            void send_mouse_motion(uint64_t timestamp, uint32_t window_id, mouse_button_state_mask state_mask, int32_t x, int32_t y, int32_t relative_x, int32_t relative_y)
-            {
-                const std::function<void(netput::rpc::Event::Info::Builder &)> &build_function = [&](netput::rpc::Event::Info::Builder &builder)
-                {
-                    auto mouse_motion_builder = builder.initMouseMotion();
-                    mouse_motion_builder.setTimestamp(timestamp);
-                    mouse_motion_builder.setWindowId(window_id);
-                    auto mouse_motion_state_builder = mouse_motion_builder.initStateMask();
-                    mouse_motion_state_builder.setLeft(input_state_to_rpc(state_mask.left));
-                    mouse_motion_state_builder.setMiddle(input_state_to_rpc(state_mask.middle));
-                    mouse_motion_state_builder.setRight(input_state_to_rpc(state_mask.right));
-                    mouse_motion_state_builder.setX1(input_state_to_rpc(state_mask.x1));
-                    mouse_motion_state_builder.setX2(input_state_to_rpc(state_mask.x2));
-                    mouse_motion_builder.setX(x);
-                    mouse_motion_builder.setY(y);
-                    mouse_motion_builder.setRelativeX(relative_x);
-                    mouse_motion_builder.setRelativeY(relative_y);
-                };
-                push(build_function);
+                return _cells[_dequeue_position & _mask].sequence.load(std::memory_order_acquire) != _dequeue_position + 1;
             }
 
-            void send_mouse_button(uint64_t timestamp, uint32_t window_id, mouse_button button, input_state state, bool double_click, int32_t x, int32_t y)
+            // single consumer only
+            bool try_pop(T &value)
             {
-                const std::function<void(netput::rpc::Event::Info::Builder &)> &build_function = [&](netput::rpc::Event::Info::Builder &builder)
-                {
-                    auto mouse_button_builder = builder.initMouseButton();
-                    mouse_button_builder.setTimestamp(timestamp);
-                    mouse_button_builder.setWindowId(window_id);
-                    mouse_button_builder.setState(input_state_to_rpc(state));
-                    mouse_button_builder.setX(x);
-                    mouse_button_builder.setY(y);
-                };
-                push(build_function);
-            }
+                cell *target;
+                size_t sequence;
 
-            void send_mouse_wheel(uint64_t timestamp, uint32_t window_id, int32_t x, int32_t y, float precise_x, float precise_y)
-            {
-                const std::function<void(netput::rpc::Event::Info::Builder &)> &build_function = [&](netput::rpc::Event::Info::Builder &builder)
+                target = &_cells[_dequeue_position & _mask];
+                sequence = target->sequence.load(std::memory_order_acquire);
+                if (sequence != _dequeue_position + 1)
                 {
-                    auto mouse_wheel_builder = builder.initMouseWheel();
-                    mouse_wheel_builder.setTimestamp(timestamp);
-                    mouse_wheel_builder.setWindowId(window_id);
-                    mouse_wheel_builder.setX(x);
-                    mouse_wheel_builder.setY(y);
-                    mouse_wheel_builder.setPreciseX(x);
-                    mouse_wheel_builder.setPreciseY(y);
-                };
-                push(build_function);
+                    return false;
+                }
+                value = target->value;
+                target->sequence.store(_dequeue_position + _mask + 1, std::memory_order_release);
+                _dequeue_position++;
+                return true;
             }
 
-            void send_window(uint64_t timestamp, uint32_t window_id, window_event type, int32_t arg1, int32_t arg2)
+        private:
+            struct cell
             {
-                const std::function<void(netput::rpc::Event::Info::Builder &)> &build_function = [&](netput::rpc::Event::Info::Builder &builder)
-                {
-                    auto window_builder = builder.initWindow();
-                    window_builder.setTimestamp(timestamp);
-                    window_builder.setWindowId(window_id);
-                    window_builder.setType(window_event_to_rpc(type));
-                    window_builder.setArg1(arg1);
-                    window_builder.setArg1(arg2);
-                };
-                push(build_function);
-            }
-
-            std::function<void(const std::string &)> _error_handler;
+                std::atomic<size_t> sequence;
+                T value;
+            };
 
-        private:
-            std::unique_ptr<capnp::EzRpcClient> _rpc_client;
-            std::unique_ptr<netput::rpc::Netput::Client> _main;
-            std::string _session_id;
+            std::unique_ptr<cell[]> _cells;
+            size_t _mask;
+            alignas(64) std::atomic<size_t> _enqueue_position;
+            alignas(64) size_t _dequeue_position;
         };
 
-        class service final : public netput::rpc::Netput::Server
+        // bounded single-producer single-consumer ring, each side keeps a cached copy of the
+        // other side's index so it only touches the shared cache line when it looks full or empty
+        template <typename T>
+        class spsc_queue
         {
         public:
-            service(
-                const std::function<void(const rpc::ConnectRequest::Reader &, rpc::ConnectResponse::Builder &)> &connect_handler,
-                const std::function<void(const rpc::Event::Reader &)> &push_handler,
-                const std::function<void(const rpc::DisconnectRequest::Reader &, rpc::DisconnectResponse::Builder &)> &disconnect_handler) : _connect_handler(connect_handler),
-                                                                                                                                             _push_handler(push_handler),
-                                                                                                                                             _disconnect_handler(disconnect_handler)
+            spsc_queue(size_t capacity)
             {
+                size_t size;
+                size = 2;
+                while (size < capacity)
+                {
+                    size <<= 1;
+                }
+                _values = std::make_unique<T[]>(size);
+                _mask = size - 1;
+                _head.store(0, std::memory_order_relaxed);
+                _cached_tail = 0;
+                _tail.store(0, std::memory_order_relaxed);
+                _cached_head = 0;
             }
 
-            kj::Promise<void> connect(netput::rpc::Netput::Server::ConnectContext context) override
+            // producer only
+            bool try_push(const T &value)
             {
-                const netput::rpc::ConnectRequest::Reader reader = context.getParams().getRequest();
-                netput::rpc::ConnectResponse::Builder builder = context.getResults().initResponse();
-                _connect_handler(reader, builder);
-                return kj::READY_NOW;
+                const size_t tail = _tail.load(std::memory_order_relaxed);
+                if (tail - _cached_head > _mask)
+                {
+                    _cached_head = _head.load(std::memory_order_acquire);
+                    if (tail - _cached_head > _mask)
+                    {
+                        return false;
+                    }
+                }
+                _values[tail & _mask] = value;
+                _tail.store(tail + 1, std::memory_order_release);
+                return true;
             }
 
-            kj::Promise<void> push(netput::rpc::Netput::Server::PushContext context) override
+            // consumer only, copies up to max values out and returns how many
+            size_t try_pop(T *values, size_t max)
             {
-                const netput::rpc::Event::Reader reader = context.getParams().getEvent();
-                _push_handler(reader);
-                return kj::READY_NOW;
+                const size_t head = _head.load(std::memory_order_relaxed);
+                size_t count;
+                if (_cached_tail - head < max)
+                {
+                    _cached_tail = _tail.load(std::memory_order_acquire);
+                }
+                count = std::min(max, _cached_tail - head);
+                for (size_t index = 0; index < count; index++)
+                {
+                    values[index] = _values[(head + index) & _mask];
+                }
+                _head.store(head + count, std::memory_order_release);
+                return count;
             }
 
-            kj::Promise<void> disconnect(netput::rpc::Netput::Server::DisconnectContext context) override
+            // any thread, a moment's approximation
+            size_t size() const
             {
-                const netput::rpc::DisconnectRequest::Reader reader = context.getParams().getRequest();
-                netput::rpc::DisconnectResponse::Builder builder = context.getResults().initResponse();
-                _disconnect_handler(reader, builder);
-                return kj::READY_NOW;
+                const size_t head = _head.load(std::memory_order_relaxed);
+                return _tail.load(std::memory_order_relaxed) - head;
             }
 
         private:
-            std::function<void(const rpc::ConnectRequest::Reader &, rpc::ConnectResponse::Builder &)> _connect_handler;
-            std::function<void(const rpc::Event::Reader &)> _push_handler;
-            std::function<void(const rpc::DisconnectRequest::Reader &, rpc::DisconnectResponse::Builder &)> _disconnect_handler;
+            std::unique_ptr<T[]> _values;
+            size_t _mask;
+            alignas(64) std::atomic<size_t> _head;
+            size_t _cached_tail;
+            alignas(64) std::atomic<size_t> _tail;
+            size_t _cached_head;
         };
 
-        class server
+        // a session's held keys and buttons, cursor per window and focus. The i/o thread is the only
+        // writer and never waits: it bumps a sequence number around every update, and readers copy
+        // the state and retry while the sequence shows they overlapped an update (a seqlock). Every
+        // field is an atomic so the racing copy is well defined
+        class input_tracker
         {
         public:
-            server(const std::string &address)
-            {
-                const auto connect_handler = [&](const rpc::ConnectRequest::Reader &reader, rpc::ConnectResponse::Builder &builder)
-                {
-                    this->handle_connect(reader, builder);
-                };
-                const auto push_handler = [&](const rpc::Event::Reader &reader)
-                {
-                    this->handle_push(reader);
-                };
-                const auto disconnect_handler = [&](const rpc::DisconnectRequest::Reader &reader, rpc::DisconnectResponse::Builder &builder)
-                {
-                    this->handle_disconnect(reader, builder);
-                };
-                _rpc_server = std::make_unique<capnp::EzRpcServer>(
-                    kj::heap<service>(connect_handler, push_handler, disconnect_handler), address);
-            }
-
-            ~server()
+            input_tracker()
             {
-                shutdown();
+                _sequence.store(0, std::memory_order_relaxed);
+                clear();
             }
 
-            void serve()
+            // i/o thread only, a session that connects again starts with nothing held
+            void reset()
             {
-                kj::WaitScope &wait_scope = _rpc_server->getWaitScope();
-                _promise_fulfiller = kj::heap<kj::PromiseCrossThreadFulfillerPair<void>>(
-                    kj::newPromiseAndCrossThreadFulfiller<void>());
-                _promise_fulfiller->promise.wait(wait_scope);
-                _rpc_server.reset();
+                const uint64_t sequence = _sequence.load(std::memory_order_relaxed);
+                _sequence.store(sequence + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                clear();
+                _sequence.store(sequence + 2, std::memory_order_release);
             }
 
-            void shutdown()
+            // i/o thread only
+            void update(const event *events, size_t count)
             {
-                _promise_fulfiller->fulfiller->fulfill();
+                const uint64_t sequence = _sequence.load(std::memory_order_relaxed);
+                _sequence.store(sequence + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                for (size_t index = 0; index < count; index++)
+                {
+                    apply(events[index]);
+                }
+                _sequence.store(sequence + 2, std::memory_order_release);
             }
 
-            void handle_connect(
-                const netput::rpc::ConnectRequest::Reader &reader,
-                netput::rpc::ConnectResponse::Builder &builder)
+            void read(input_snapshot &state) const
             {
-                const uint8_t *user_data_buffer;
-                size_t user_data_size;
-                std::pair<bool, std::string> result;
-
-                if (reader.hasUserData())
+                uint64_t before;
+                uint64_t after;
+                uint64_t focus;
+                uint64_t window;
+                uint64_t position;
+                do
                 {
-                    const capnp::Data::Reader &user_data = reader.getUserData();
-                    user_data_buffer = user_data.begin();
-                    user_data_size = user_data.size();
-                }
-                else
-                {
-                    user_data_buffer = nullptr;
-                    user_data_size = 0;
-                }
+                    before = _sequence.load(std::memory_order_acquire);
+                    while ((before & 1) != 0)
+                    {
+                        std::this_thread::yield();
+                        before = _sequence.load(std::memory_order_acquire);
+                    }
+                    for (size_t index = 0; index < key_words; index++)
+                    {
+                        state.keys[index] = _keys[index].load(std::memory_order_relaxed);
+                    }
+                    state.buttons = static_cast<uint8_t>(_buttons.load(std::memory_order_relaxed));
+                    focus = _focus.load(std::memory_order_relaxed);
+                    state.cursor_count = 0;
+                    for (size_t index = 0; index < tracked_windows; index++)
+                    {
+                        window = _windows[index].load(std::memory_order_relaxed);
+                        position = _positions[index].load(std::memory_order_relaxed);
+                        if ((window & used_flag) != 0)
+                        {
+                            state.cursors[state.cursor_count].window_id = static_cast<uint32_t>(window);
+                            state.cursors[state.cursor_count].x = static_cast<int32_t>(static_cast<uint32_t>(position >> 32));
+                            state.cursors[state.cursor_count].y = static_cast<int32_t>(static_cast<uint32_t>(position));
+                            state.cursor_count++;
+                        }
+                    }
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    after = _sequence.load(std::memory_order_relaxed);
+                } while (before != after);
+                state.focused = (focus & used_flag) != 0;
+                state.focus_window_id = static_cast<uint32_t>(focus);
+            }
 
-                if (_connect_handler)
-                {
-                    result = _connect_handler(user_data_buffer, user_data_size);
-                }
-                else
-                {
-                    result.first = false;
-                    result.second = "unimplemented connection handler";
-                }
+        private:
+            static const size_t key_words = tracked_key_codes / 64;
+            static const uint64_t used_flag = uint64_t(1) << 32;
 
-                if (result.first)
+            void clear()
+            {
+                for (std::atomic<uint64_t> &word : _keys)
                 {
-                    builder.initMessage().setSessionId(result.second);
+                    word.store(0, std::memory_order_relaxed);
                 }
-                else
+                _buttons.store(0, std::memory_order_relaxed);
+                _focus.store(0, std::memory_order_relaxed);
+                for (size_t index = 0; index < tracked_windows; index++)
                 {
-                    builder.initMessage().setError(result.second);
+                    _windows[index].store(0, std::memory_order_relaxed);
+                    _positions[index].store(0, std::memory_order_relaxed);
+                    _touched[index] = 0;
                 }
+                _cursor_count = 0;
+                _updates = 0;
             }
 
-            void handle_push(const netput::rpc::Event::Reader &reader)
+            void apply(const event &record)
             {
-                const std::string session_id = reader.getSessionId();
-                const netput::rpc::Event::Info::Reader info = reader.getInfo();
-                switch (info.which())
-                {
-                case netput::rpc::Event::Info::MOUSE_MOTION:
+                uint64_t word;
+                uint64_t bit;
+                uint32_t mask;
+                switch (record.type)
                 {
-                    const netput::rpc::MouseMotionEvent::Reader mouse_motion_reader = info.getMouseMotion();
-                    handle_mouse_motion(session_id, mouse_motion_reader);
+                case event_type::keyboard:
+                    if (record.keyboard.key_code < tracked_key_codes)
+                    {
+                        bit = uint64_t(1) << (record.keyboard.key_code % 64);
+                        word = _keys[record.keyboard.key_code / 64].load(std::memory_order_relaxed);
+                        word = (record.keyboard.state == input_state::pressed) ? (word | bit) : (word & ~bit);
+                        _keys[record.keyboard.key_code / 64].store(word, std::memory_order_relaxed);
+                    }
                     break;
-                }
-                case netput::rpc::Event::Info::MOUSE_BUTTON:
-                {
-                    const netput::rpc::MouseButtonEvent::Reader mouse_button_reader = info.getMouseButton();
-                    handle_mouse_button(session_id, mouse_button_reader);
+                case event_type::mouse_motion:
+                    // motion carries the whole mask, so it also repairs a button event that went missing
+                    _buttons.store(button_bits(record.mouse_motion.state_mask), std::memory_order_relaxed);
+                    move_cursor(record.window_id, record.mouse_motion.x, record.mouse_motion.y);
                     break;
-                }
-                case netput::rpc::Event::Info::MOUSE_WHEEL:
-                {
-                    const netput::rpc::MouseWheelEvent::Reader mouse_wheel_reader = info.getMouseWheel();
-                    handle_mouse_wheel(session_id, mouse_wheel_reader);
+                case event_type::mouse_button:
+                    mask = _buttons.load(std::memory_order_relaxed);
+                    mask = (record.mouse_button.state == input_state::pressed) ? (mask | (1u << record.mouse_button.button)) : (mask & ~(1u << record.mouse_button.button));
+                    _buttons.store(mask, std::memory_order_relaxed);
+                    move_cursor(record.window_id, record.mouse_button.x, record.mouse_button.y);
                     break;
-                }
-                case netput::rpc::Event::Info::KEYBOARD:
-                {
-                    const netput::rpc::KeyboardEvent::Reader keyboard_reader = info.getKeyboard();
-                    handle_keyboard(session_id, keyboard_reader);
+                case event_type::mouse_wheel:
                     break;
-                }
-                case netput::rpc::Event::Info::WINDOW:
-                {
-                    const netput::rpc::WindowEvent::Reader window_reader = info.getWindow();
-                    handle_window(session_id, window_reader);
+                case event_type::window:
+                    if (record.window.type == window_event::focus_gained)
+                    {
+                        _focus.store(used_flag | record.window_id, std::memory_order_relaxed);
+                    }
+                    else if (record.window.type == window_event::focus_lost &&
+                             _focus.load(std::memory_order_relaxed) == (used_flag | record.window_id))
+                    {
+                        _focus.store(0, std::memory_order_relaxed);
+                    }
                     break;
                 }
-                }
             }
 
-            void handle_disconnect(
-                const netput::rpc::DisconnectRequest::Reader &reader,
-                netput::rpc::DisconnectResponse::Builder &builder)
+            // a window past tracked_windows takes the slot of the one whose cursor moved longest ago
+            void move_cursor(uint32_t window_id, int32_t x, int32_t y)
             {
-                bool success;
-                success = true;
-                if (_disconnect_handler)
+                size_t slot;
+                slot = 0;
+                while (slot < _cursor_count && _windows[slot].load(std::memory_order_relaxed) != (used_flag | window_id))
                 {
-                    if (reader.hasSessionId())
+                    slot++;
+                }
+                if (slot == _cursor_count)
+                {
+                    if (_cursor_count < tracked_windows)
                     {
-                        success = _disconnect_handler(reader.getSessionId());
+                        _cursor_count++;
                     }
                     else
                     {
-                        success = false;
+                        slot = std::min_element(_touched, _touched + tracked_windows) - _touched;
                     }
+                    _windows[slot].store(used_flag | window_id, std::memory_order_relaxed);
                 }
-
-                if (!success)
-                {
-                    builder.setError("disconnect failed");
-                }
+                _positions[slot].store((uint64_t(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y), std::memory_order_relaxed);
+                _touched[slot] = ++_updates;
             }
 
-            // TODO: maybe move these, probably not
+            std::atomic<uint64_t> _sequence;
+            std::atomic<uint64_t> _keys[key_words];
+            std::atomic<uint32_t> _buttons;
+            // window id with used_flag while a window has focus
+            std::atomic<uint64_t> _focus;
+            // window id with used_flag, and x and y packed in one word
+            std::atomic<uint64_t> _windows[tracked_windows];
+            std::atomic<uint64_t> _positions[tracked_windows];
+            // i/o thread only
+            uint64_t _touched[tracked_windows];
+            size_t _cursor_count;
+            uint64_t _updates;
+        };
+
+        // one per open session id, events carry the number and queued work can point at it. The
+        // server frees it on disconnect or once its last session capability is dropped
+        struct session_entry
+        {
+            std::string id;
+            uint32_t number;
+            size_t hash;
+            // session capabilities still using the entry, under the sessions lock
+            size_t references;
+            // null unless the server tracks input state, shared so a reader can finish with it
+            // after the entry is freed
+            std::shared_ptr<input_tracker> input;
+        };
+
+        static void build_event_info(netput::rpc::Event::Info::Builder &builder, const event &record)
+        {
+            switch (record.type)
+            {
+            case event_type::keyboard:
+            {
+                auto keyboard_builder = builder.initKeyboard();
+                keyboard_builder.setTimestamp(record.timestamp);
+                keyboard_builder.setWindowId(record.window_id);
+                keyboard_builder.setState(input_state_to_rpc(record.keyboard.state));
+                keyboard_builder.setRepeat(record.keyboard.repeat);
+                keyboard_builder.setKeyCode(record.keyboard.key_code);
+                break;
+            }
+            case event_type::mouse_motion:
+            {
+                auto mouse_motion_builder = builder.initMouseMotion();
+                mouse_motion_builder.setTimestamp(record.timestamp);
+                mouse_motion_builder.setWindowId(record.window_id);
+                // the bits fill a hole in the data section, the old nested mask is left unset
+                mouse_motion_builder.setButtons(button_bits(record.mouse_motion.state_mask));
+                mouse_motion_builder.setX(record.mouse_motion.x);
+                mouse_motion_builder.setY(record.mouse_motion.y);
+                mouse_motion_builder.setRelativeX(record.mouse_motion.relative_x);
+                mouse_motion_builder.setRelativeY(record.mouse_motion.relative_y);
+                break;
+            }
+            case event_type::mouse_button:
+            {
+                auto mouse_button_builder = builder.initMouseButton();
+                mouse_button_builder.setTimestamp(record.timestamp);
+                mouse_button_builder.setWindowId(record.window_id);
+                mouse_button_builder.setButton(mouse_button_to_rpc(record.mouse_button.button));
+                mouse_button_builder.setState(input_state_to_rpc(record.mouse_button.state));
+                mouse_button_builder.setDouble(record.mouse_button.double_click);
+                mouse_button_builder.setX(record.mouse_button.x);
+                mouse_button_builder.setY(record.mouse_button.y);
+                break;
+            }
+            case event_type::mouse_wheel:
+            {
+                auto mouse_wheel_builder = builder.initMouseWheel();
+                mouse_wheel_builder.setTimestamp(record.timestamp);
+                mouse_wheel_builder.setWindowId(record.window_id);
+                mouse_wheel_builder.setX(record.mouse_wheel.x);
+                mouse_wheel_builder.setY(record.mouse_wheel.y);
+                mouse_wheel_builder.setPreciseX(record.mouse_wheel.precise_x);
+                mouse_wheel_builder.setPreciseY(record.mouse_wheel.precise_y);
+                break;
+            }
+            case event_type::window:
+            {
+                auto window_builder = builder.initWindow();
+                window_builder.setTimestamp(record.timestamp);
+                window_builder.setWindowId(record.window_id);
+                window_builder.setType(window_event_to_rpc(record.window.type));
+                window_builder.setArg1(record.window.arg1);
+                window_builder.setArg2(record.window.arg2);
+                break;
+            }
+            }
+        }
+
+        // inverse of build_event_info, returns false for a union member this build does not know
+        static bool read_event_info(const netput::rpc::Event::Info::Reader &info, event &record)
+        {
+            bool result;
+            result = true;
+            switch (info.which())
+            {
+            case netput::rpc::Event::Info::KEYBOARD:
+            {
+                const netput::rpc::KeyboardEvent::Reader reader = info.getKeyboard();
+                record.type = event_type::keyboard;
+                record.timestamp = reader.getTimestamp();
+                record.window_id = reader.getWindowId();
+                record.keyboard.state = input_state_from_rpc(reader.getState());
+                record.keyboard.repeat = reader.getRepeat();
+                record.keyboard.key_code = reader.getKeyCode();
+                break;
+            }
+            case netput::rpc::Event::Info::MOUSE_MOTION:
+            {
+                const netput::rpc::MouseMotionEvent::Reader reader = info.getMouseMotion();
+                record.type = event_type::mouse_motion;
+                record.timestamp = reader.getTimestamp();
+                record.window_id = reader.getWindowId();
+                // only older clients send the nested mask
+                if (reader.hasStateMask())
+                {
+                    const netput::rpc::MouseMotionEvent::MouseStateMask::Reader state_mask_reader = reader.getStateMask();
+                    record.mouse_motion.state_mask.left = input_state_from_rpc(state_mask_reader.getLeft());
+                    record.mouse_motion.state_mask.middle = input_state_from_rpc(state_mask_reader.getMiddle());
+                    record.mouse_motion.state_mask.right = input_state_from_rpc(state_mask_reader.getRight());
+                    record.mouse_motion.state_mask.x1 = input_state_from_rpc(state_mask_reader.getX1());
+                    record.mouse_motion.state_mask.x2 = input_state_from_rpc(state_mask_reader.getX2());
+                }
+                else
+                {
+                    record.mouse_motion.state_mask = button_state_mask(reader.getButtons());
+                }
+                record.mouse_motion.x = reader.getX();
+                record.mouse_motion.y = reader.getY();
+                record.mouse_motion.relative_x = reader.getRelativeX();
+                record.mouse_motion.relative_y = reader.getRelativeY();
+                break;
+            }
+            case netput::rpc::Event::Info::MOUSE_BUTTON:
+            {
+                const netput::rpc::MouseButtonEvent::Reader reader = info.getMouseButton();
+                // an enumerant added by a newer client has no mouse_button to map to
+                if (reader.getButton() > rpc::MouseButton::X2)
+                {
+                    result = false;
+                    break;
+                }
+                record.type = event_type::mouse_button;
+                record.timestamp = reader.getTimestamp();
+                record.window_id = reader.getWindowId();
+                record.mouse_button.button = mouse_button_from_rpc(reader.getButton());
+                record.mouse_button.state = input_state_from_rpc(reader.getState());
+                record.mouse_button.double_click = reader.getDouble();
+                record.mouse_button.x = reader.getX();
+                record.mouse_button.y = reader.getY();
+                break;
+            }
+            case netput::rpc::Event::Info::MOUSE_WHEEL:
+            {
+                const netput::rpc::MouseWheelEvent::Reader reader = info.getMouseWheel();
+                record.type = event_type::mouse_wheel;
+                record.timestamp = reader.getTimestamp();
+                record.window_id = reader.getWindowId();
+                record.mouse_wheel.x = reader.getX();
+                record.mouse_wheel.y = reader.getY();
+                record.mouse_wheel.precise_x = reader.getPreciseX();
+                record.mouse_wheel.precise_y = reader.getPreciseY();
+                break;
+            }
+            case netput::rpc::Event::Info::WINDOW:
+            {
+                const netput::rpc::WindowEvent::Reader reader = info.getWindow();
+                if (reader.getType() > rpc::WindowEventType::FOCUS_LOST_TYPE)
+                {
+                    result = false;
+                    break;
+                }
+                record.type = event_type::window;
+                record.timestamp = reader.getTimestamp();
+                record.window_id = reader.getWindowId();
+                record.window.type = window_event_from_rpc(reader.getType());
+                record.window.arg1 = reader.getArg1();
+                record.window.arg2 = reader.getArg2();
+                break;
+            }
+            default:
+                result = false;
+                break;
+            }
+            return result;
+        }
+
+        static bool same_state_mask(const mouse_button_state_mask &lhs, const mouse_button_state_mask &rhs)
+        {
+            return lhs.left == rhs.left &&
+                   lhs.middle == rhs.middle &&
+                   lhs.right == rhs.right &&
+                   lhs.x1 == rhs.x1 &&
+                   lhs.x2 == rhs.x2;
+        }
+
+        static bool merge_mouse_motion(event &target, const event &source)
+        {
+            int64_t relative_x;
+            int64_t relative_y;
+            bool result;
+
+            result = false;
+            if (same_state_mask(target.mouse_motion.state_mask, source.mouse_motion.state_mask))
+            {
+                relative_x = static_cast<int64_t>(target.mouse_motion.relative_x) + source.mouse_motion.relative_x;
+                relative_y = static_cast<int64_t>(target.mouse_motion.relative_y) + source.mouse_motion.relative_y;
+                // only merge when the summed deltas stay exact
+                if (relative_x >= INT32_MIN && relative_x <= INT32_MAX && relative_y >= INT32_MIN && relative_y <= INT32_MAX)
+                {
+                    target.timestamp = source.timestamp;
+                    target.mouse_motion.x = source.mouse_motion.x;
+                    target.mouse_motion.y = source.mouse_motion.y;
+                    target.mouse_motion.relative_x = static_cast<int32_t>(relative_x);
+                    target.mouse_motion.relative_y = static_cast<int32_t>(relative_y);
+                    result = true;
+                }
+            }
+            return result;
+        }
+
+        // merges each mouse motion record into the latest motion of the same window inside
+        // the current run of consecutive motion records, so motion never moves across any
+        // other event type and each window's samples stay in order
+        static size_t coalesce_mouse_motion(std::vector<event> &records)
+        {
+            size_t run_start;
+            size_t count;
+            size_t index;
+            size_t previous;
+            bool merged;
+
+            run_start = 0;
+            count = 0;
+            for (index = 0; index < records.size(); index++)
+            {
+                merged = false;
+                if (records[index].type == event_type::mouse_motion)
+                {
+                    previous = count;
+                    while (previous > run_start && records[previous - 1].window_id != records[index].window_id)
+                    {
+                        previous--;
+                    }
+                    if (previous > run_start)
+                    {
+                        merged = merge_mouse_motion(records[previous - 1], records[index]);
+                    }
+                }
+                if (!merged)
+                {
+                    records[count] = records[index];
+                    count++;
+                    if (records[index].type != event_type::mouse_motion)
+                    {
+                        run_start = count;
+                    }
+                }
+            }
+
+            index = records.size() - count;
+            records.resize(count);
+            return index;
+        }
+
+        const size_t max_parity_group = 64;
+
+        static uint64_t monotonic_ns()
+        {
+            return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+        }
+
+        // statistic with a single writing thread, which updates it with a relaxed load and store
+        // instead of a locked read-modify-write so it can stay on in production
+        class counter
+        {
+        public:
+            void add(uint64_t amount)
+            {
+                _value.store(_value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+            }
+
+            void set(uint64_t value)
+            {
+                _value.store(value, std::memory_order_relaxed);
+            }
+
+            uint64_t get() const
+            {
+                return _value.load(std::memory_order_relaxed);
+            }
+
+        private:
+            std::atomic<uint64_t> _value{0};
+        };
+
+        static bool is_continuous(event_type type)
+        {
+            return type == event_type::mouse_motion || type == event_type::mouse_wheel;
+        }
+
+        // bytes an event adds to a pushBatch message: its list element and the struct behind its info pointer
+        static size_t encoded_size(const event &record)
+        {
+            size_t words;
+            words = capnp::sizeInWords<netput::rpc::Event>();
+            switch (record.type)
+            {
+            case event_type::keyboard:
+                words += capnp::sizeInWords<netput::rpc::KeyboardEvent>();
+                break;
+            case event_type::mouse_motion:
+                words += capnp::sizeInWords<netput::rpc::MouseMotionEvent>();
+                break;
+            case event_type::mouse_button:
+                words += capnp::sizeInWords<netput::rpc::MouseButtonEvent>();
+                break;
+            case event_type::mouse_wheel:
+                words += capnp::sizeInWords<netput::rpc::MouseWheelEvent>();
+                break;
+            case event_type::window:
+                words += capnp::sizeInWords<netput::rpc::WindowEvent>();
+                break;
+            }
+            return words * sizeof(capnp::word);
+        }
+
+        // client side of the udp side channel. Numbers the datagrams from 1 and, with a parity group
+        // of k, follows datagrams k*g+1 .. k*g+k with one carrying the xor of their bytes
+        class datagram_encoder
+        {
+        public:
+            datagram_encoder()
+            {
+                reset(0, 0);
+            }
+
+            void reset(uint64_t token, size_t group_size)
+            {
+                _token = token;
+                _group_size = group_size;
+                _sequence = 0;
+                _members = 0;
+                _parity.clear();
+            }
+
+            template <typename Send>
+            void encode(const event &record, uint64_t epoch, const Send &send)
+            {
+                capnp::MallocMessageBuilder message(datagram_words);
+                netput::rpc::Datagram::Builder datagram = message.initRoot<netput::rpc::Datagram>();
+                datagram.setToken(_token);
+                datagram.setSequence(++_sequence);
+                datagram.setEpoch(epoch);
+                auto info_builder = datagram.initEvent().initInfo();
+                build_event_info(info_builder, record);
+                const kj::Array<capnp::word> words = capnp::messageToFlatArray(message);
+                send(words.asBytes());
+                if (_group_size > 0)
+                {
+                    absorb(words.asBytes());
+                    if (++_members == _group_size)
+                    {
+                        send_parity(send);
+                    }
+                }
+            }
+
+            uint64_t sequence() const
+            {
+                return _sequence;
+            }
+
+        private:
+            void absorb(const kj::ArrayPtr<const kj::byte> &bytes)
+            {
+                if (_parity.size() < bytes.size())
+                {
+                    _parity.resize(bytes.size(), 0);
+                }
+                for (size_t index = 0; index < bytes.size(); index++)
+                {
+                    _parity[index] ^= bytes[index];
+                }
+            }
+
+            // carries the sequence of the last member, which names the group
+            template <typename Send>
+            void send_parity(const Send &send)
+            {
+                capnp::MallocMessageBuilder message(datagram_words);
+                netput::rpc::Datagram::Builder datagram = message.initRoot<netput::rpc::Datagram>();
+                datagram.setToken(_token);
+                datagram.setSequence(_sequence);
+                capnp::Data::Builder parity = datagram.initParity(_parity.size());
+                std::memcpy(parity.begin(), _parity.data(), _parity.size());
+                const kj::Array<capnp::word> words = capnp::messageToFlatArray(message);
+                send(words.asBytes());
+                _members = 0;
+                _parity.clear();
+            }
+
+            static const unsigned int datagram_words = 32;
+
+            uint64_t _token;
+            size_t _group_size;
+            uint64_t _sequence;
+            size_t _members;
+            std::vector<kj::byte> _parity;
+        };
+
+        // server side of the udp side channel, one per connection. Hands datagrams on in sequence
+        // order and drops what is older than the last one handed on. With parity groups a datagram
+        // that follows a single hole in its group waits for the group's parity, which rebuilds the
+        // missing one from the xor of the others; any other hole is a plain loss
+        class datagram_decoder
+        {
+        public:
+            datagram_decoder()
+            {
+                reset(0);
+            }
+
+            void reset(size_t group_size)
+            {
+                _group_size = group_size;
+                _last = 0;
+                _recovered = 0;
+                _held.clear();
+                _held.reserve(group_size);
+                start(0);
+            }
+
+            // accept(sequence, epoch, record) runs for every datagram handed on, returns the number
+            // of datagrams discarded
+            template <typename Accept>
+            size_t receive(const kj::ArrayPtr<const kj::byte> &bytes, const netput::rpc::Datagram::Reader &datagram, const Accept &accept)
+            {
+                return datagram.hasParity() ? receive_parity(datagram, accept) : receive_data(bytes, datagram, accept, true);
+            }
+
+            uint64_t recovered() const
+            {
+                return _recovered;
+            }
+
+        private:
+            struct held_datagram
+            {
+                uint64_t sequence;
+                uint64_t epoch;
+                event record;
+            };
+
+            template <typename Accept>
+            size_t receive_data(const kj::ArrayPtr<const kj::byte> &bytes, const netput::rpc::Datagram::Reader &datagram, const Accept &accept, bool absorbed)
+            {
+                event record;
+                const uint64_t sequence = datagram.getSequence();
+                uint64_t group;
+                uint64_t bit;
+
+                if (sequence <= _last || !datagram.hasEvent() || !read_event_info(datagram.getEvent().getInfo(), record) || !is_continuous(record.type))
+                {
+                    return 1;
+                }
+                if (_group_size == 0)
+                {
+                    _last = sequence;
+                    accept(sequence, datagram.getEpoch(), record);
+                    return 0;
+                }
+
+                group = (sequence - 1) / _group_size;
+                bit = uint64_t(1) << ((sequence - 1) % _group_size);
+                if (group > _group)
+                {
+                    // the parity of the earlier group is not coming anymore
+                    release(accept);
+                    start(group);
+                }
+                if (group == _group)
+                {
+                    if ((_received & bit) != 0)
+                    {
+                        return 1;
+                    }
+                    _received |= bit;
+                    if (absorbed)
+                    {
+                        absorb(bytes);
+                    }
+                }
+
+                if (sequence == _last + 1)
+                {
+                    _last = sequence;
+                    accept(sequence, datagram.getEpoch(), record);
+                    drain(accept);
+                }
+                else if (group == _group && missing(sequence) == 1)
+                {
+                    hold(sequence, datagram.getEpoch(), record);
+                }
+                else
+                {
+                    release(accept);
+                    _last = sequence;
+                    accept(sequence, datagram.getEpoch(), record);
+                }
+                return 0;
+            }
+
+            template <typename Accept>
+            size_t receive_parity(const netput::rpc::Datagram::Reader &datagram, const Accept &accept)
+            {
+                const uint64_t sequence = datagram.getSequence();
+                const capnp::Data::Reader parity = datagram.getParity();
+                uint64_t group;
+                size_t index;
+
+                if (_group_size == 0 || sequence == 0 || (sequence - 1) / _group_size < _group)
+                {
+                    return 1;
+                }
+                group = (sequence - 1) / _group_size;
+                if (group > _group)
+                {
+                    release(accept);
+                    start(group);
+                }
+                if (missing(_group * _group_size + _group_size) == 1)
+                {
+                    if (_parity.size() < parity.size())
+                    {
+                        _parity.resize(parity.size(), 0);
+                    }
+                    for (index = 0; index < parity.size(); index++)
+                    {
+                        _parity[index] ^= parity[index];
+                    }
+                    rebuild(accept);
+                }
+                release(accept);
+                start(_group + 1);
+                return 0;
+            }
+
+            // the xor of the group's parity and every member received is the missing member
+            template <typename Accept>
+            void rebuild(const Accept &accept)
+            {
+                _words.resize(_parity.size() / sizeof(capnp::word));
+                std::memcpy(_words.data(), _parity.data(), _words.size() * sizeof(capnp::word));
+                try
+                {
+                    capnp::FlatArrayMessageReader message(kj::arrayPtr(reinterpret_cast<const capnp::word *>(_words.data()), _words.size()));
+                    const netput::rpc::Datagram::Reader datagram = message.getRoot<netput::rpc::Datagram>();
+                    if (!datagram.hasParity() && (datagram.getSequence() - 1) / _group_size == _group &&
+                        receive_data(kj::ArrayPtr<const kj::byte>(), datagram, accept, false) == 0)
+                    {
+                        _recovered++;
+                    }
+                }
+                catch (const kj::Exception &)
+                {
+                }
+                catch (const std::exception &)
+                {
+                }
+            }
+
+            void absorb(const kj::ArrayPtr<const kj::byte> &bytes)
+            {
+                if (_parity.size() < bytes.size())
+                {
+                    _parity.resize(bytes.size(), 0);
+                }
+                for (size_t index = 0; index < bytes.size(); index++)
+                {
+                    _parity[index] ^= bytes[index];
+                }
+            }
+
+            // members of the current group up to sequence that have not arrived
+            size_t missing(uint64_t sequence) const
+            {
+                const uint64_t members = sequence - _group * _group_size;
+                const uint64_t mask = (members >= 64) ? ~uint64_t(0) : (uint64_t(1) << members) - 1;
+                return static_cast<size_t>(members - std::bitset<64>(_received & mask).count());
+            }
+
+            void hold(uint64_t sequence, uint64_t epoch, const event &record)
+            {
+                held_datagram entry;
+                entry.sequence = sequence;
+                entry.epoch = epoch;
+                entry.record = record;
+                const auto position = std::upper_bound(
+                    _held.begin(),
+                    _held.end(),
+                    sequence,
+                    [](uint64_t value, const held_datagram &held)
+                    {
+                        return value < held.sequence;
+                    });
+                _held.insert(position, entry);
+            }
+
+            // hands on what waited behind a hole that is now filled
+            template <typename Accept>
+            void drain(const Accept &accept)
+            {
+                size_t count;
+                count = 0;
+                while (count < _held.size() && _held[count].sequence == _last + 1)
+                {
+                    _last = _held[count].sequence;
+                    accept(_held[count].sequence, _held[count].epoch, _held[count].record);
+                    count++;
+                }
+                _held.erase(_held.begin(), _held.begin() + count);
+            }
+
+            // gives up on the hole, everything held goes on in order
+            template <typename Accept>
+            void release(const Accept &accept)
+            {
+                for (const held_datagram &held : _held)
+                {
+                    _last = held.sequence;
+                    accept(held.sequence, held.epoch, held.record);
+                }
+                _held.clear();
+            }
+
+            // holes left in earlier groups are final, whatever is still missing there counts as late
+            void start(uint64_t group)
+            {
+                _last = std::max(_last, group * _group_size);
+                _group = group;
+                _received = 0;
+                _parity.clear();
+            }
+
+            size_t _group_size;
+            uint64_t _last;
+            uint64_t _recovered;
+            uint64_t _group;
+            uint64_t _received;
+            std::vector<kj::byte> _parity;
+            // capnp::word cannot be copied, so the aligned copy is kept as plain 64-bit words
+            std::vector<uint64_t> _words;
+            std::vector<held_datagram> _held;
+        };
+
+        class client final : public kj::TaskSet::ErrorHandler
+        {
+        public:
+            client(const std::string &address)
+            {
+                _rpc_client = std::make_unique<capnp::EzRpcClient>(address);
+                _main = std::make_unique<netput::rpc::Netput::Client>(_rpc_client->getMain<netput::rpc::Netput::Client>());
+                _tasks = kj::heap<kj::TaskSet>(*this);
+                _address = address;
+                _send_mode = send_mode::blocking;
+                _max_in_flight = 0;
+                _in_flight = 0;
+                _batching = false;
+                _coalescing = false;
+                _coalesced_events.store(0);
+                _datagrams = false;
+                _parity_group = 0;
+                _datagram_port_number = 0;
+                _reliable = 0;
+                _policy = {0, 0, 0, false};
+                _policy_enabled = false;
+                _batch_bytes = 0;
+                _batch_started_ns = 0;
+                _last_queued_ns = 0;
+                _interarrival_ns = 0;
+                _round_trip_ns = 0;
+            }
+
+            ~client()
+            {
+                // cancelled pushes release their slots, so drop them before the rest of the state
+                _tasks = nullptr;
+            }
+
+            client(const client &copy) = delete;
+
+            void connect(const uint8_t *buffer, size_t size)
+            {
+                close_datagrams();
+                auto request = _main->connectRequest();
+                auto builder = request.initRequest();
+                auto user_data_builder = builder.initUserData(size);
+                if (size > 0)
+                {
+                    std::memcpy(user_data_builder.begin(), buffer, size);
+                }
+                builder.setDatagrams(_datagrams);
+                builder.setParityGroup(static_cast<uint8_t>(_parity_group));
+                auto promise = request.send();
+                // events can be pipelined on the session before the reply arrives
+                _session = std::make_unique<netput::rpc::Session::Client>(promise.getResponse().getSession());
+                if (_send_mode == send_mode::pipelined)
+                {
+                    const auto accept_response = [this](capnp::Response<netput::rpc::Netput::ConnectResults> &&reader)
+                    {
+                        accept(reader);
+                        return open_datagrams();
+                    };
+                    const auto release_slot = [this]()
+                    {
+                        release();
+                    };
+                    // kept for the next flush() rather than the error handler, connect() has already returned
+                    const auto connect_failed = [this](kj::Exception &&exception)
+                    {
+                        _connect_error = exception.getDescription().cStr();
+                    };
+                    reserve();
+                    _in_flight++;
+                    _in_flight_count.set(_in_flight);
+                    _connect_error.clear();
+                    _tasks->add(promise.then(accept_response).catch_(connect_failed).attach(kj::defer(release_slot)));
+                }
+                else
+                {
+                    accept(promise.wait(_rpc_client->getWaitScope()));
+                    open_datagrams().wait(_rpc_client->getWaitScope());
+                }
+            }
+
+            void disconnect()
+            {
+                std::exception_ptr stream_error;
+                try
+                {
+                    flush();
+                }
+                catch (const std::runtime_error &)
+                {
+                    // the session is closed either way, the stream's failure is reported afterwards
+                    stream_error = std::current_exception();
+                }
+                auto request = _main->disconnectRequest();
+                auto builder = request.initRequest();
+                builder.setSessionId(_session_id);
+                auto promise = request.send();
+                auto reader = promise.wait(_rpc_client->getWaitScope());
+                _session.reset();
+                close_datagrams();
+                if (reader.hasResponse() && reader.getResponse().hasError())
+                {
+                    throw std::runtime_error(std::string("error returned from server: ") + reader.getResponse().getError().cStr());
+                }
+                if (stream_error)
+                {
+                    std::rethrow_exception(stream_error);
+                }
+            }
+
+            void send(const event &record)
+            {
+                _sent[static_cast<size_t>(record.type)].add(1);
+                if (_datagram_port.get() != nullptr && is_continuous(record.type))
+                {
+                    send_datagram(record);
+                    return;
+                }
+                _reliable++;
+                if (_batching)
+                {
+                    _batch.push_back(record);
+                }
+                else if (_policy_enabled)
+                {
+                    queue(record);
+                }
+                else if (_send_mode == send_mode::streaming)
+                {
+                    auto request = session().pushStreamRequest();
+                    auto info_builder = request.initEvent().initInfo();
+                    build_event_info(info_builder, record);
+                    _bytes.add(request.totalSize().wordCount * sizeof(capnp::word));
+                    // only blocks once the stream's flow control window is full
+                    request.send().wait(_rpc_client->getWaitScope());
+                }
+                else
+                {
+                    auto request = session().pushRequest();
+                    auto info_builder = request.initEvent().initInfo();
+                    build_event_info(info_builder, record);
+                    send_request(request);
+                }
+            }
+
+            void begin_batch()
+            {
+                _batching = true;
+            }
+
+            void send_batch()
+            {
+                if (_batching)
+                {
+                    _batching = false;
+                    send_queued();
+                }
+            }
+
+            void set_flush_policy(const flush_policy &policy)
+            {
+                if (!_batching)
+                {
+                    send_queued();
+                }
+                _policy = policy;
+                _policy_enabled = policy.max_events > 0 || policy.max_bytes > 0 || policy.max_delay_us > 0 || policy.adaptive;
+            }
+
+            // sends the policy's batch once its oldest event is due, for callers that wake on the deadline
+            void flush_expired()
+            {
+                if (!_batching && !_batch.empty() && _policy.max_delay_us > 0 &&
+                    monotonic_ns() - _batch_started_ns >= _policy.max_delay_us * 1000)
+                {
+                    send_queued();
+                }
+            }
+
+            // resolves when the policy's batch is due, never while nothing is waiting on a deadline
+            kj::Promise<void> batch_deadline()
+            {
+                uint64_t elapsed_ns;
+                uint64_t remaining_ns;
+                if (_batching || _batch.empty() || _policy.max_delay_us == 0)
+                {
+                    return kj::NEVER_DONE;
+                }
+                elapsed_ns = monotonic_ns() - _batch_started_ns;
+                remaining_ns = (elapsed_ns < _policy.max_delay_us * 1000) ? _policy.max_delay_us * 1000 - elapsed_ns : 0;
+                return _rpc_client->getIoProvider().getTimer().afterDelay(static_cast<int64_t>(remaining_ns) * kj::NANOSECONDS);
+            }
+
+            // merges queued mouse motion in place when coalescing is enabled
+            void coalesce(std::vector<event> &records)
+            {
+                if (_coalescing)
+                {
+                    _coalesced_events.fetch_add(coalesce_mouse_motion(records), std::memory_order_relaxed);
+                }
+            }
+
+            void set_coalescing(bool enabled)
+            {
+                _coalescing = enabled;
+            }
+
+            void set_udp(bool enabled, size_t parity_group)
+            {
+                if (parity_group > max_parity_group)
+                {
+                    throw std::runtime_error("parity_group must be at most 64");
+                }
+                _datagrams = enabled;
+                _parity_group = parity_group;
+            }
+
+            uint64_t coalesced_events() const
+            {
+                return _coalesced_events.load(std::memory_order_relaxed);
+            }
+
+            // safe from any thread
+            client_stats stats() const
+            {
+                client_stats result;
+                for (size_t index = 0; index < event_type_count; index++)
+                {
+                    result.events[index] = _sent[index].get();
+                }
+                result.bytes = _bytes.get();
+                result.datagrams = _datagrams_sent.get();
+                result.in_flight = _in_flight_count.get();
+                result.queue_depth = 0;
+                result.coalesced_events = coalesced_events();
+                return result;
+            }
+
+            template <typename Request>
+            void send_request(Request &request)
+            {
+                const uint64_t sent_ns = monotonic_ns();
+                _bytes.add(request.totalSize().wordCount * sizeof(capnp::word));
+                if (_send_mode == send_mode::pipelined)
+                {
+                    const auto release_slot = [this]()
+                    {
+                        release();
+                    };
+                    const auto completed = [this, sent_ns]()
+                    {
+                        observe_round_trip(sent_ns);
+                    };
+                    reserve();
+                    _in_flight++;
+                    _in_flight_count.set(_in_flight);
+                    _tasks->add(request.send().ignoreResult().then(completed).attach(kj::defer(release_slot)));
+                    _rpc_client->getWaitScope().poll();
+                }
+                else
+                {
+                    auto promise = request.send();
+                    promise.wait(_rpc_client->getWaitScope());
+                    observe_round_trip(sent_ns);
+                }
+            }
+
+            void set_send_mode(send_mode mode, size_t max_in_flight)
+            {
+                if (mode == send_mode::pipelined && max_in_flight == 0)
+                {
+                    throw std::runtime_error("max_in_flight must be greater than zero");
+                }
+                if (mode != _send_mode)
+                {
+                    flush();
+                }
+                _send_mode = mode;
+                _max_in_flight = max_in_flight;
+            }
+
+            void flush()
+            {
+                if (!_batching)
+                {
+                    send_queued();
+                }
+                if (_in_flight > 0)
+                {
+                    _tasks->onEmpty().wait(_rpc_client->getWaitScope());
+                }
+                if (!_connect_error.empty())
+                {
+                    const std::string error = std::move(_connect_error);
+                    _connect_error.clear();
+                    throw std::runtime_error("connect failed: " + error);
+                }
+                if (_send_mode == send_mode::streaming && _session)
+                {
+                    sync_stream();
+                }
+            }
+
+            void taskFailed(kj::Exception &&exception) override
+            {
+                report_error(exception.getDescription().cStr());
+            }
+
+            void report_error(const std::string &message)
+            {
+                if (_error_handler)
+                {
+                    _error_handler(message);
+                }
+            }
+
+            kj::WaitScope &get_wait_scope()
+            {
+                return _rpc_client->getWaitScope();
+            }
+
+            std::function<void(const std::string &)> _error_handler;
+
+        private:
+            void accept(const netput::rpc::Netput::ConnectResults::Reader &reader)
+            {
+                if (!reader.hasResponse())
+                {
+                    throw std::runtime_error("failed to read response from server");
+                }
+                auto response = reader.getResponse();
+                auto message = response.getMessage();
+                if (message.isError())
+                {
+                    throw std::runtime_error(std::string("error returned from server: ") + message.getError().cStr());
+                }
+
+                _session_id = message.getSessionId();
+                _datagram_port_number = response.getDatagramPort();
+                _encoder.reset(response.getDatagramToken(), _parity_group);
+            }
+
+            // binds a local port of the server address' family once connect granted the side channel,
+            // motion and wheel keep going over the stream if that fails
+            kj::Promise<void> open_datagrams()
+            {
+                if (_datagram_port_number == 0)
+                {
+                    return kj::READY_NOW;
+                }
+                kj::Network &network = _rpc_client->getIoProvider().getNetwork();
+                const auto bind = [this, &network](kj::Own<kj::NetworkAddress> &&destination)
+                {
+                    const bool ipv6 = destination->toString().startsWith("[");
+                    _datagram_address = kj::mv(destination);
+                    return network.parseAddress(ipv6 ? "[::]" : "0.0.0.0").then(
+                        [this](kj::Own<kj::NetworkAddress> &&local)
+                        {
+                            _datagram_port = local->bindDatagramPort();
+                        });
+                };
+                const auto fallback = [this](kj::Exception &&exception)
+                {
+                    _datagram_address = nullptr;
+                    report_error(std::string("udp side channel unavailable: ") + exception.getDescription().cStr());
+                };
+                return resolve_datagram_address(network, address_host(_address), _datagram_port_number).then(bind).catch_(fallback);
+            }
+
+            // every connect starts a new channel, the server numbers it from zero as well
+            void close_datagrams()
+            {
+                _datagram_port = nullptr;
+                _datagram_address = nullptr;
+                _datagram_port_number = 0;
+                _encoder.reset(0, 0);
+                _reliable = 0;
+            }
+
+            // epoch is the number of events handed to the stream before this one, which is what the
+            // server orders the datagram against
+            void send_datagram(const event &record)
+            {
+                const auto send = [this](const kj::ArrayPtr<const kj::byte> &bytes)
+                {
+                    // only waits while the socket buffer is full, a lost datagram is never resent
+                    _datagram_port->send(bytes.begin(), bytes.size(), *_datagram_address).wait(_rpc_client->getWaitScope());
+                    _datagrams_sent.add(1);
+                    _bytes.add(bytes.size());
+                };
+                _encoder.encode(record, _reliable, send);
+            }
+
+            // adds record to the policy's batch and sends the batch once any of its limits is reached
+            void queue(const event &record)
+            {
+                const uint64_t now_ns = monotonic_ns();
+                if (_last_queued_ns != 0)
+                {
+                    smooth(_interarrival_ns, std::min(now_ns - _last_queued_ns, max_interarrival_ns));
+                }
+                _last_queued_ns = now_ns;
+                if (_batch.empty())
+                {
+                    _batch_started_ns = now_ns;
+                }
+                _batch.push_back(record);
+                _batch_bytes += encoded_size(record);
+                if (_batch.size() >= batch_limit() ||
+                    (_policy.max_bytes > 0 && _batch_bytes >= _policy.max_bytes) ||
+                    (_policy.max_delay_us > 0 && now_ns - _batch_started_ns >= _policy.max_delay_us * 1000))
+                {
+                    send_queued();
+                }
+            }
+
+            // the adaptive limit is about a quarter round trip's worth of events, so a batch adds
+            // little next to the network's own delay; it starts at one until a round trip is measured
+            size_t batch_limit() const
+            {
+                size_t limit;
+                uint64_t adaptive;
+                limit = (_policy.max_events > 0) ? _policy.max_events : SIZE_MAX;
+                if (_policy.adaptive)
+                {
+                    adaptive = (_round_trip_ns > 0 && _interarrival_ns > 0) ? _round_trip_ns / (4 * _interarrival_ns) : 1;
+                    limit = std::min<uint64_t>(limit, std::max<uint64_t>(adaptive, 1));
+                }
+                return limit;
+            }
+
+            void send_queued()
+            {
+                const size_t queued = _batch.size();
+                coalesce(_batch);
+                // merged events never reach the server, which counts what arrives on the stream
+                _reliable -= queued - _batch.size();
+                if (!_batch.empty())
+                {
+                    auto request = session().pushBatchRequest();
+                    auto events_builder = request.initEvents(_batch.size());
+                    for (size_t index = 0; index < _batch.size(); index++)
+                    {
+                        auto info_builder = events_builder[index].initInfo();
+                        build_event_info(info_builder, _batch[index]);
+                    }
+                    _batch.clear();
+                    _batch_bytes = 0;
+                    send_request(request);
+                }
+            }
+
+            void observe_round_trip(uint64_t sent_ns)
+            {
+                smooth(_round_trip_ns, monotonic_ns() - sent_ns);
+            }
+
+            // moving average over about the last eight samples, the way tcp smooths its rtt
+            static void smooth(uint64_t &average, uint64_t sample)
+            {
+                average = (average == 0) ? sample : average - average / 8 + sample / 8;
+            }
+
+            // a failed stream call is only reported to a later regular call on the same capability,
+            // an empty batch is that call and also waits for every stream call before it
+            void sync_stream()
+            {
+                auto request = _session->pushBatchRequest();
+                request.initEvents(0);
+                try
+                {
+                    request.send().wait(_rpc_client->getWaitScope());
+                }
+                catch (const kj::Exception &exception)
+                {
+                    throw std::runtime_error(std::string("streamed push failed: ") + exception.getDescription().cStr());
+                }
+            }
+
+            netput::rpc::Session::Client &session()
+            {
+                if (!_session)
+                {
+                    throw std::runtime_error("client is not connected");
+                }
+                return *_session;
+            }
+
+            // blocks on the event loop until a pipelined push slot is available
+            void reserve()
+            {
+                while (_in_flight >= _max_in_flight)
+                {
+                    auto paf = kj::newPromiseAndFulfiller<void>();
+                    _slot_fulfiller = kj::mv(paf.fulfiller);
+                    paf.promise.wait(_rpc_client->getWaitScope());
+                }
+            }
+
+            void release()
+            {
+                _in_flight--;
+                _in_flight_count.set(_in_flight);
+                if (_slot_fulfiller.get() != nullptr)
+                {
+                    _slot_fulfiller->fulfill();
+                    _slot_fulfiller = nullptr;
+                }
+            }
+
+            // an idle spell does not drag the average gap between events up for long
+            static constexpr uint64_t max_interarrival_ns = 1000000000;
+
+            std::unique_ptr<capnp::EzRpcClient> _rpc_client;
+            std::unique_ptr<netput::rpc::Netput::Client> _main;
+            std::unique_ptr<netput::rpc::Session::Client> _session;
+            std::string _address;
+            std::string _session_id;
+            // a pipelined connect's failure, until flush() throws it
+            std::string _connect_error;
+            bool _batching;
+            std::vector<event> _batch;
+            bool _coalescing;
+            std::atomic<uint64_t> _coalesced_events;
+            kj::Own<kj::TaskSet> _tasks;
+            kj::Own<kj::PromiseFulfiller<void>> _slot_fulfiller;
+            send_mode _send_mode;
+            size_t _max_in_flight;
+            size_t _in_flight;
+            flush_policy _policy;
+            bool _policy_enabled;
+            size_t _batch_bytes;
+            uint64_t _batch_started_ns;
+            uint64_t _last_queued_ns;
+            uint64_t _interarrival_ns;
+            uint64_t _round_trip_ns;
+            counter _sent[event_type_count];
+            counter _bytes;
+            counter _datagrams_sent;
+            counter _in_flight_count;
+            bool _datagrams;
+            size_t _parity_group;
+            uint16_t _datagram_port_number;
+            uint64_t _reliable;
+            datagram_encoder _encoder;
+            kj::Own<kj::NetworkAddress> _datagram_address;
+            kj::Own<kj::DatagramPort> _datagram_port;
+        };
+
+        // owns the rpc client on a dedicated thread; send_* callers only touch the queue
+        class client_thread
+        {
+            // declared first, record_wait takes lane_counters in its signature
+            struct queued_event
+            {
+                event record;
+                uint64_t enqueued_ns;
+                // continuous events queued before this one, orders a discrete event against them
+                uint64_t order;
+            };
+
+            struct lane_counters
+            {
+                std::atomic<uint64_t> events{0};
+                std::atomic<uint64_t> wait_ns{0};
+                std::atomic<uint64_t> max_wait_ns{0};
+            };
+
+        public:
+            client_thread(const std::string &address, size_t queue_capacity) : _discrete(queue_capacity),
+                                                                               _continuous(queue_capacity)
+            {
+                _client = nullptr;
+                _capacity = queue_capacity;
+                _continuous_pushed.store(0);
+                _discrete_pushed.store(0);
+                _pending.reserve(queue_capacity);
+                std::promise<void> started;
+                std::future<void> result;
+
+                _running.store(true);
+                _sleeping.store(false);
+                result = started.get_future();
+                _thread = std::thread(
+                    [this, address, started = std::move(started)]() mutable
+                    {
+                        run(address, started);
+                    });
+                try
+                {
+                    result.get();
+                }
+                catch (...)
+                {
+                    _thread.join();
+                    throw;
+                }
+            }
+
+            ~client_thread()
+            {
+                _running.store(false);
+                wake();
+                _thread.join();
+            }
+
+            client_thread(const client_thread &copy) = delete;
+
+            void push(const event &record)
+            {
+                queued_event queued;
+                mpsc_queue<queued_event> *queue;
+
+                queued.record = record;
+                queued.enqueued_ns = monotonic_ns();
+                if (is_continuous(record.type))
+                {
+                    queued.order = _continuous_pushed.fetch_add(1, std::memory_order_relaxed);
+                    queue = &_continuous;
+                }
+                else
+                {
+                    queued.order = _continuous_pushed.load(std::memory_order_relaxed);
+                    _discrete_pushed.fetch_add(1, std::memory_order_relaxed);
+                    queue = &_discrete;
+                }
+                while (!queue->try_push(queued))
+                {
+                    wake();
+                    std::this_thread::yield();
+                }
+                // pairs with the fence in run() so a sleeping io thread always sees the record
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (_sleeping.load(std::memory_order_relaxed))
+                {
+                    wake();
+                }
+            }
+
+            uint64_t coalesced_events() const
+            {
+                return _client->coalesced_events();
+            }
+
+            client_stats stats() const
+            {
+                uint64_t pushed;
+                uint64_t sent;
+                client_stats result = _client->stats();
+                pushed = _discrete_pushed.load(std::memory_order_relaxed) + _continuous_pushed.load(std::memory_order_relaxed);
+                sent = _lanes[0].events.load(std::memory_order_relaxed) + _lanes[1].events.load(std::memory_order_relaxed);
+                // the two loads race with the producers and the io thread
+                result.queue_depth = (pushed > sent) ? pushed - sent : 0;
+                return result;
+            }
+
+            lane_stats get_lane_stats(lane which) const
+            {
+                const lane_counters &counters = _lanes[static_cast<size_t>(which)];
+                lane_stats result;
+                result.events = counters.events.load(std::memory_order_relaxed);
+                result.total_wait_ns = counters.wait_ns.load(std::memory_order_relaxed);
+                result.max_wait_ns = counters.max_wait_ns.load(std::memory_order_relaxed);
+                return result;
+            }
+
+            // runs function on the io thread after everything already queued, rethrowing its errors
+            void execute(const std::function<void(client &)> &function)
+            {
+                std::packaged_task<void(client &)> task(function);
+                std::future<void> result;
+
+                result = task.get_future();
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _commands.push_back(std::move(task));
+                }
+                wake();
+                result.get();
+            }
+
+        private:
+            void run(const std::string &address, std::promise<void> &started)
+            {
+                std::unique_ptr<client> rpc_client;
+
+                try
+                {
+                    rpc_client = std::make_unique<client>(address);
+                }
+                catch (...)
+                {
+                    started.set_exception(std::current_exception());
+                    return;
+                }
+                _client = rpc_client.get();
+                started.set_value();
+
+                while (true)
+                {
+                    drain(*rpc_client);
+                    if (!_running.load())
+                    {
+                        break;
+                    }
+
+                    auto paf = kj::newPromiseAndCrossThreadFulfiller<void>();
+                    {
+                        std::lock_guard<std::mutex> lock(_mutex);
+                        _wake_fulfiller = kj::mv(paf.fulfiller);
+                    }
+                    _sleeping.store(true, std::memory_order_relaxed);
+                    std::atomic_thread_fence(std::memory_order_seq_cst);
+                    if (!idle())
+                    {
+                        _sleeping.store(false, std::memory_order_relaxed);
+                        continue;
+                    }
+                    // keeps servicing rpc completions while waiting for work or a flush policy deadline
+                    paf.promise.exclusiveJoin(rpc_client->batch_deadline()).wait(rpc_client->get_wait_scope());
+                    _sleeping.store(false, std::memory_order_relaxed);
+                }
+
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _wake_fulfiller = nullptr;
+                }
+            }
+
+            // discrete events go out ahead of the motion and wheel backlog, except for motion and wheel
+            // of the same window queued before them, which is sent first (coalesced) so the server sees
+            // a click at the position the cursor had reached
+            void drain(client &rpc_client)
+            {
+                queued_event queued;
+                size_t count;
+                std::deque<std::packaged_task<void(client &)>> commands;
+
+                do
+                {
+                    count = 0;
+                    while (count < drain_limit && _discrete.try_pop(queued))
+                    {
+                        // whatever was queued before it sits within the next capacity entries
+                        collect(_capacity);
+                        send_pending(rpc_client, queued.record.window_id, queued.order);
+                        record_wait(_lanes[static_cast<size_t>(lane::discrete)], queued.enqueued_ns);
+                        guard(
+                            rpc_client,
+                            [&]()
+                            {
+                                rpc_client.send(queued.record);
+                            });
+                        count++;
+                    }
+                    count += collect(drain_limit);
+                    send_pending(rpc_client, 0, UINT64_MAX);
+                } while (count > 0);
+                guard(
+                    rpc_client,
+                    [&]()
+                    {
+                        rpc_client.flush_expired();
+                    });
+
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    commands.swap(_commands);
+                }
+                for (std::packaged_task<void(client &)> &command : commands)
+                {
+                    command(rpc_client);
+                }
+            }
+
+            // moves up to max queued continuous events into pending, io thread only
+            size_t collect(size_t max)
+            {
+                queued_event queued;
+                size_t count;
+                count = 0;
+                while (count < max && _continuous.try_pop(queued))
+                {
+                    _pending.push_back(queued);
+                    count++;
+                }
+                return count;
+            }
+
+            // sends the pending events queued before fence, all of them or those of one window
+            void send_pending(client &rpc_client, uint32_t window_id, uint64_t fence)
+            {
+                size_t kept;
+                _records.clear();
+                kept = 0;
+                for (const queued_event &pending : _pending)
+                {
+                    if (pending.order < fence && (fence == UINT64_MAX || pending.record.window_id == window_id))
+                    {
+                        record_wait(_lanes[static_cast<size_t>(lane::continuous)], pending.enqueued_ns);
+                        _records.push_back(pending.record);
+                    }
+                    else
+                    {
+                        _pending[kept] = pending;
+                        kept++;
+                    }
+                }
+                _pending.resize(kept);
+                rpc_client.coalesce(_records);
+                for (const event &record : _records)
+                {
+                    guard(
+                        rpc_client,
+                        [&]()
+                        {
+                            rpc_client.send(record);
+                        });
+                }
+            }
+
+            // io thread errors go to the error handler instead of ending the thread
+            template <typename Function>
+            void guard(client &rpc_client, const Function &function)
+            {
+                try
+                {
+                    function();
+                }
+                catch (const kj::Exception &exception)
+                {
+                    rpc_client.report_error(exception.getDescription().cStr());
+                }
+                catch (const std::exception &error)
+                {
+                    rpc_client.report_error(error.what());
+                }
+            }
+
+            // io thread is the only writer
+            void record_wait(lane_counters &counters, uint64_t enqueued_ns)
+            {
+                const uint64_t wait_ns = monotonic_ns() - enqueued_ns;
+                counters.events.store(counters.events.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+                counters.wait_ns.store(counters.wait_ns.load(std::memory_order_relaxed) + wait_ns, std::memory_order_relaxed);
+                if (wait_ns > counters.max_wait_ns.load(std::memory_order_relaxed))
+                {
+                    counters.max_wait_ns.store(wait_ns, std::memory_order_relaxed);
+                }
+            }
+
+            bool idle()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                return _running.load() && _commands.empty() && _discrete.empty() && _continuous.empty();
+            }
+
+            void wake()
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                if (_wake_fulfiller.get() != nullptr)
+                {
+                    _wake_fulfiller->fulfill();
+                    _wake_fulfiller = nullptr;
+                }
+            }
+
+            static const size_t drain_limit = 256;
+
+            size_t _capacity;
+            mpsc_queue<queued_event> _discrete;
+            mpsc_queue<queued_event> _continuous;
+            std::atomic<uint64_t> _continuous_pushed;
+            std::atomic<uint64_t> _discrete_pushed;
+            std::vector<queued_event> _pending;
+            lane_counters _lanes[2];
+            std::vector<event> _records;
+            client *_client;
+            std::thread _thread;
+            std::atomic<bool> _running;
+            std::atomic<bool> _sleeping;
+            std::mutex _mutex;
+            std::deque<std::packaged_task<void(client &)>> _commands;
+            kj::Own<kj::CrossThreadPromiseFulfiller<void>> _wake_fulfiller;
+        };
+
+        // fixed set of dispatch threads, every session hashes to one worker so its events stay in order
+        class worker_pool
+        {
+        public:
+            worker_pool(
+                size_t count,
+                const std::function<void(const session_entry &, const event &)> &dispatch_handler,
+                const std::function<void(const std::string &)> &error_handler) : _dispatch_handler(dispatch_handler), _error_handler(error_handler)
+            {
+                for (size_t index = 0; index < count; index++)
+                {
+                    _workers.push_back(std::make_unique<worker>());
+                    _workers.back()->items.reserve(initial_capacity);
+                    _workers.back()->pending.reserve(initial_capacity);
+                }
+                for (const std::unique_ptr<worker> &target : _workers)
+                {
+                    worker *target_worker = target.get();
+                    target_worker->thread = std::thread(
+                        [this, target_worker]()
+                        {
+                            this->run(*target_worker);
+                        });
+                }
+            }
+
+            // drains every queued item before joining
+            ~worker_pool()
+            {
+                for (const std::unique_ptr<worker> &target : _workers)
+                {
+                    {
+                        std::lock_guard<std::mutex> lock(target->mutex);
+                        target->running = false;
+                    }
+                    target->ready.notify_one();
+                }
+                for (const std::unique_ptr<worker> &target : _workers)
+                {
+                    target->thread.join();
+                }
+            }
+
+            void push(const session_entry &session, const event &record)
+            {
+                item next;
+                next.session = &session;
+                next.record = record;
+                enqueue(session.hash, std::move(next));
+            }
+
+            // resolves on the calling event loop once the session's worker has handled everything queued before it
+            kj::Promise<void> barrier(const std::string &session_id)
+            {
+                item next;
+                kj::PromiseCrossThreadFulfillerPair<void> pair = kj::newPromiseAndCrossThreadFulfiller<void>();
+                next.session = nullptr;
+                next.barrier = kj::mv(pair.fulfiller);
+                enqueue(std::hash<std::string>()(session_id), std::move(next));
+                return kj::mv(pair.promise);
+            }
+
+            // frees a closed session's entry once its worker is past every event queued for it
+            void retire(std::unique_ptr<session_entry> &&entry)
+            {
+                item next;
+                const size_t hash = entry->hash;
+                next.session = nullptr;
+                next.retired = std::move(entry);
+                enqueue(hash, std::move(next));
+            }
+
+            // blocking form of barrier for callers without an event loop
+            void wait(const std::string &session_id)
+            {
+                item next;
+                std::promise<void> done;
+                next.session = nullptr;
+                next.done = &done;
+                enqueue(std::hash<std::string>()(session_id), std::move(next));
+                done.get_future().wait();
+            }
+
+            std::vector<worker_stats> stats() const
+            {
+                std::vector<worker_stats> result;
+                worker_stats entry;
+                for (const std::unique_ptr<worker> &target : _workers)
+                {
+                    std::lock_guard<std::mutex> lock(target->mutex);
+                    entry.queue_depth = target->items.size();
+                    entry.max_queue_depth = target->max_depth;
+                    entry.events = target->events;
+                    entry.handler_ns = target->handler_ns;
+                    result.push_back(entry);
+                }
+                return result;
+            }
+
+        private:
+            struct item
+            {
+                const session_entry *session;
+                event record;
+                kj::Own<kj::CrossThreadPromiseFulfiller<void>> barrier;
+                std::promise<void> *done = nullptr;
+                std::unique_ptr<session_entry> retired;
+            };
+
+            // both buffers are swapped back and forth and only ever grow, so a warm pool does not allocate
+            static const size_t initial_capacity = 1024;
+
+            struct worker
+            {
+                std::thread thread;
+                mutable std::mutex mutex;
+                std::condition_variable ready;
+                std::vector<item> items;
+                std::vector<item> pending;
+                size_t max_depth = 0;
+                uint64_t events = 0;
+                uint64_t handler_ns = 0;
+                bool running = true;
+            };
+
+            void enqueue(size_t hash, item &&next)
+            {
+                worker &target = *_workers[hash % _workers.size()];
+                bool was_empty;
+                {
+                    std::lock_guard<std::mutex> lock(target.mutex);
+                    was_empty = target.items.empty();
+                    target.items.push_back(std::move(next));
+                    target.max_depth = std::max(target.max_depth, target.items.size());
+                }
+                if (was_empty)
+                {
+                    target.ready.notify_one();
+                }
+            }
+
+            void run(worker &target)
+            {
+                std::vector<item> &items = target.pending;
+                uint64_t events;
+                uint64_t handler_ns;
+                uint64_t started;
+                std::unique_lock<std::mutex> lock(target.mutex);
+                while (true)
+                {
+                    target.ready.wait(
+                        lock,
+                        [&]()
+                        {
+                            return !target.items.empty() || !target.running;
+                        });
+                    if (target.items.empty())
+                    {
+                        break;
+                    }
+                    items.swap(target.items);
+                    lock.unlock();
+                    events = 0;
+                    handler_ns = 0;
+                    for (item &current : items)
+                    {
+                        if (current.barrier.get() != nullptr)
+                        {
+                            current.barrier->fulfill();
+                        }
+                        else if (current.done != nullptr)
+                        {
+                            current.done->set_value();
+                        }
+                        else if (current.retired)
+                        {
+                            current.retired.reset();
+                        }
+                        else
+                        {
+                            // a throwing handler must not take the worker, and every later event of its sessions, down with it
+                            started = monotonic_ns();
+                            try
+                            {
+                                _dispatch_handler(*current.session, current.record);
+                            }
+                            catch (const std::exception &error)
+                            {
+                                _error_handler(std::string("handler failed: ") + error.what());
+                            }
+                            handler_ns += monotonic_ns() - started;
+                            events++;
+                        }
+                    }
+                    items.clear();
+                    lock.lock();
+                    target.events += events;
+                    target.handler_ns += handler_ns;
+                }
+            }
+
+            std::function<void(const session_entry &, const event &)> _dispatch_handler;
+            std::function<void(const std::string &)> _error_handler;
+            std::vector<std::unique_ptr<worker>> _workers;
+        };
+
+        // appends a server's traffic to a log of LogEntry messages in standard stream framing. The
+        // i/o thread encodes entries into a buffer and a writer thread group-commits the buffer to
+        // the file every commit_interval_ms or commit_bytes, so recording never waits on the disk
+        class recorder
+        {
+        public:
+            recorder(const std::string &path, const std::function<void(const std::string &)> &error_handler) : _error_handler(error_handler)
+            {
+                _file.open(path, std::ios::binary | std::ios::app);
+                if (!_file)
+                {
+                    throw std::runtime_error("failed to open recording " + path);
+                }
+                _scratch.resize(scratch_words);
+                _filling.reserve(2 * commit_bytes);
+                _writing.reserve(2 * commit_bytes);
+                _running = true;
+                _thread = std::thread(
+                    [this]()
+                    {
+                        this->run();
+                    });
+            }
+
+            // everything recorded so far reaches the file before it closes
+            ~recorder()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    _running = false;
+                }
+                _ready.notify_one();
+                _thread.join();
+            }
+
+            recorder(const recorder &copy) = delete;
+
+            void record_events(const session_entry &session, const event *events, size_t count)
+            {
+                const uint64_t receive_time = wall_clock_ns();
+                const capnp::Text::Reader session_id(session.id.data(), session.id.size());
+                bool full;
+                {
+                    std::lock_guard<std::mutex> lock(_mutex);
+                    for (size_t index = 0; index < count; index++)
+                    {
+                        const auto build = [&](netput::rpc::LogEntry::Builder &entry)
+                        {
+                            auto info_builder = entry.initEvent().initInfo();
+                            build_event_info(info_builder, events[index]);
+                        };
+                        append(netput::rpc::LogEntryKind::EVENT, session_id, receive_time, build);
+                    }
+                    full = _filling.size() >= commit_bytes;
+                }
+                if (full)
+                {
+                    _ready.notify_one();
+                }
+            }
+
+            void record_connect(const capnp::Text::Reader &session_id, const uint8_t *buffer, size_t size)
+            {
+                const auto build = [&](netput::rpc::LogEntry::Builder &entry)
+                {
+                    if (size > 0)
+                    {
+                        entry.setUserData(capnp::Data::Reader(buffer, size));
+                    }
+                };
+                std::lock_guard<std::mutex> lock(_mutex);
+                append(netput::rpc::LogEntryKind::CONNECT, session_id, wall_clock_ns(), build);
+            }
+
+            void record_disconnect(const capnp::Text::Reader &session_id)
+            {
+                const auto build = [](netput::rpc::LogEntry::Builder &)
+                {
+                };
+                std::lock_guard<std::mutex> lock(_mutex);
+                append(netput::rpc::LogEntryKind::DISCONNECT, session_id, wall_clock_ns(), build);
+            }
+
+        private:
+            // an entry fits in the scratch segment unless it carries large connect data
+            static const size_t scratch_words = 64;
+            static const size_t commit_bytes = 1 << 20;
+            static constexpr int64_t commit_interval_ms = 10;
+
+            static uint64_t wall_clock_ns()
+            {
+                return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+            }
+
+            // with _mutex held
+            template <typename Build>
+            void append(netput::rpc::LogEntryKind kind, const capnp::Text::Reader &session_id, uint64_t receive_time, const Build &build)
+            {
+                // the first segment of a message builder has to start out zeroed
+                std::memset(_scratch.data(), 0, scratch_words * sizeof(capnp::word));
+                capnp::MallocMessageBuilder message(kj::arrayPtr(reinterpret_cast<capnp::word *>(_scratch.data()), scratch_words));
+                netput::rpc::LogEntry::Builder entry = message.initRoot<netput::rpc::LogEntry>();
+                entry.setKind(kind);
+                entry.setSession(session_id);
+                entry.setReceiveTime(receive_time);
+                build(entry);
+
+                // the segment table: segment count less one, each segment's size in words, padded to a word
+                const kj::ArrayPtr<const kj::ArrayPtr<const capnp::word>> segments = message.getSegmentsForOutput();
+                append_word_count(segments.size() - 1);
+                for (const kj::ArrayPtr<const capnp::word> &segment : segments)
+                {
+                    append_word_count(segment.size());
+                }
+                if (segments.size() % 2 == 0)
+                {
+                    append_word_count(0);
+                }
+                for (const kj::ArrayPtr<const capnp::word> &segment : segments)
+                {
+                    const kj::ArrayPtr<const kj::byte> bytes = segment.asBytes();
+                    _filling.insert(_filling.end(), bytes.begin(), bytes.end());
+                }
+            }
+
+            void append_word_count(size_t count)
+            {
+                const uint32_t value = static_cast<uint32_t>(count);
+                kj::byte bytes[sizeof(value)];
+                // capnp framing is little-endian
+                for (size_t index = 0; index < sizeof(value); index++)
+                {
+                    bytes[index] = static_cast<kj::byte>(value >> (8 * index));
+                }
+                _filling.insert(_filling.end(), bytes, bytes + sizeof(value));
+            }
+
+            void run()
+            {
+                bool running;
+                std::unique_lock<std::mutex> lock(_mutex);
+                do
+                {
+                    _ready.wait_for(
+                        lock,
+                        std::chrono::milliseconds(commit_interval_ms),
+                        [this]()
+                        {
+                            return _filling.size() >= commit_bytes || !_running;
+                        });
+                    running = _running;
+                    _writing.swap(_filling);
+                    lock.unlock();
+                    if (!_writing.empty())
+                    {
+                        _file.write(reinterpret_cast<const char *>(_writing.data()), _writing.size());
+                        _file.flush();
+                        if (!_file)
+                        {
+                            _error_handler("recording write failed, " + std::to_string(_writing.size()) + " bytes lost");
+                            _file.clear();
+                        }
+                        _writing.clear();
+                    }
+                    lock.lock();
+                } while (running);
+            }
+
+            std::ofstream _file;
+            std::function<void(const std::string &)> _error_handler;
+            std::vector<uint64_t> _scratch;
+            std::mutex _mutex;
+            std::condition_variable _ready;
+            std::vector<kj::byte> _filling;
+            std::vector<kj::byte> _writing;
+            bool _running;
+            std::thread _thread;
+        };
+
+        // a recording decoded into memory, entries in log order
+        class replay
+        {
+        public:
+            replay(const std::string &path)
+            {
+                std::ifstream file(path, std::ios::binary | std::ios::ate);
+                std::vector<uint64_t> words;
+                std::unordered_map<std::string, size_t> sessions;
+                size_t size;
+
+                if (!file)
+                {
+                    throw std::runtime_error("failed to open recording " + path);
+                }
+                size = static_cast<size_t>(file.tellg());
+                words.resize(size / sizeof(capnp::word));
+                file.seekg(0);
+                file.read(reinterpret_cast<char *>(words.data()), words.size() * sizeof(capnp::word));
+
+                kj::ArrayPtr<const capnp::word> remaining(reinterpret_cast<const capnp::word *>(words.data()), words.size());
+                while (remaining.size() > 0)
+                {
+                    entry next;
+                    bool readable;
+                    try
+                    {
+                        capnp::FlatArrayMessageReader message(remaining);
+                        const netput::rpc::LogEntry::Reader reader = message.getRoot<netput::rpc::LogEntry>();
+                        const std::string session_id(reader.getSession().begin(), reader.getSession().size());
+                        const auto found = sessions.emplace(session_id, _user_data.size());
+                        if (found.second)
+                        {
+                            _user_data.emplace_back();
+                        }
+                        next.kind = reader.getKind();
+                        next.session = found.first->second;
+                        next.receive_time = reader.getReceiveTime();
+                        switch (next.kind)
+                        {
+                        case netput::rpc::LogEntryKind::EVENT:
+                            readable = read_event_info(reader.getEvent().getInfo(), next.record);
+                            break;
+                        case netput::rpc::LogEntryKind::CONNECT:
+                            _user_data[next.session].assign(reader.getUserData().begin(), reader.getUserData().end());
+                            readable = true;
+                            break;
+                        case netput::rpc::LogEntryKind::DISCONNECT:
+                            readable = true;
+                            break;
+                        default:
+                            // written by a newer recorder
+                            readable = false;
+                            break;
+                        }
+                        remaining = kj::arrayPtr(message.getEnd(), remaining.end());
+                    }
+                    catch (const kj::Exception &)
+                    {
+                        // a recorder that did not shut down cleanly leaves a torn last entry
+                        break;
+                    }
+                    if (readable)
+                    {
+                        _entries.push_back(next);
+                    }
+                }
+            }
+
+            replay_stats play(const std::string &address, const replay_options &options)
+            {
+                std::vector<std::unique_ptr<netput::client>> clients(_user_data.size());
+                std::vector<uint64_t> first_timestamp(_user_data.size());
+                std::vector<uint64_t> first_offset(_user_data.size(), UINT64_MAX);
+                std::chrono::steady_clock::time_point start;
+                std::chrono::steady_clock::time_point due;
+                uint64_t offset;
+                uint64_t error;
+                replay_stats result;
+
+                if (options.mode == replay_mode::scaled && !(options.speed > 0.0))
+                {
+                    throw std::invalid_argument("replay speed must be greater than zero");
+                }
+                // with no length per timestamp unit every event would be due at once
+                if (options.mode != replay_mode::maximum && options.timestamp_ns == 0)
+                {
+                    throw std::invalid_argument("replay timestamp_ns must be greater than zero");
+                }
+                result = replay_stats();
+                start = std::chrono::steady_clock::now();
+                for (const entry &current : _entries)
+                {
+                    std::unique_ptr<netput::client> &target = clients[current.session];
+                    // markers keep their place in the log, a session's events keep the spacing of
+                    // their timestamps from its first event on
+                    // the wall clock the receive times come from can step backwards
+                    offset = (current.receive_time > _entries.front().receive_time) ? current.receive_time - _entries.front().receive_time : 0;
+                    if (current.kind == netput::rpc::LogEntryKind::EVENT)
+                    {
+                        if (first_offset[current.session] == UINT64_MAX)
+                        {
+                            first_offset[current.session] = offset;
+                            first_timestamp[current.session] = current.record.timestamp;
+                        }
+                        offset = first_offset[current.session];
+                        if (current.record.timestamp > first_timestamp[current.session])
+                        {
+                            offset += (current.record.timestamp - first_timestamp[current.session]) * options.timestamp_ns;
+                        }
+                    }
+                    if (options.mode != replay_mode::maximum)
+                    {
+                        due = start + std::chrono::nanoseconds(static_cast<int64_t>((options.mode == replay_mode::scaled) ? offset / options.speed : offset));
+                        std::this_thread::sleep_until(due);
+                        error = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - due).count();
+                        result.mean_error_ns += error;
+                        result.max_error_ns = std::max(result.max_error_ns, error);
+                    }
+
+                    if (current.kind == netput::rpc::LogEntryKind::CONNECT || (current.kind == netput::rpc::LogEntryKind::EVENT && !target))
+                    {
+                        // a session already running when recording started connects with no user data
+                        const std::vector<uint8_t> &user_data = _user_data[current.session];
+                        if (target)
+                        {
+                            target->disconnect();
+                        }
+                        target = std::make_unique<netput::client>(address);
+                        target->connect(user_data.data(), user_data.size());
+                        // a blocking round trip per event would hold every later entry behind it
+                        target->set_send_mode(send_mode::pipelined);
+                        result.sessions++;
+                    }
+                    if (current.kind == netput::rpc::LogEntryKind::EVENT)
+                    {
+                        target->send(current.record);
+                        result.events++;
+                    }
+                    else if (current.kind == netput::rpc::LogEntryKind::DISCONNECT && target)
+                    {
+                        target->disconnect();
+                        target.reset();
+                    }
+                }
+                for (std::unique_ptr<netput::client> &target : clients)
+                {
+                    if (target)
+                    {
+                        target->disconnect();
+                    }
+                }
+
+                result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+                result.events_per_second = (result.seconds > 0.0) ? result.events / result.seconds : 0.0;
+                if (!_entries.empty() && options.mode != replay_mode::maximum)
+                {
+                    result.mean_error_ns /= _entries.size();
+                }
+                return result;
+            }
+
+        private:
+            struct entry
+            {
+                netput::rpc::LogEntryKind kind;
+                size_t session;
+                uint64_t receive_time;
+                event record;
+            };
+
+            std::vector<entry> _entries;
+            // connect data of each session, indexed by entry::session
+            std::vector<std::vector<uint8_t>> _user_data;
+        };
+
+        static bool valid_input_state(input_state state)
+        {
+            return state == input_state::released || state == input_state::pressed;
+        }
+
+        // records from the shared-memory ring were written by another process, anything the
+        // tracker or a handler would index or shift by has to be in range
+        static bool valid_shm_record(const event &record)
+        {
+            bool valid;
+            switch (record.type)
+            {
+            case event_type::keyboard:
+                valid = valid_input_state(record.keyboard.state);
+                break;
+            case event_type::mouse_motion:
+                valid = valid_input_state(record.mouse_motion.state_mask.left) &&
+                        valid_input_state(record.mouse_motion.state_mask.middle) &&
+                        valid_input_state(record.mouse_motion.state_mask.right) &&
+                        valid_input_state(record.mouse_motion.state_mask.x1) &&
+                        valid_input_state(record.mouse_motion.state_mask.x2);
+                break;
+            case event_type::mouse_button:
+                valid = record.mouse_button.button >= mouse_button::left && record.mouse_button.button <= mouse_button::x2 &&
+                        valid_input_state(record.mouse_button.state);
+                break;
+            case event_type::mouse_wheel:
+                valid = true;
+                break;
+            case event_type::window:
+                valid = record.window.type >= window_event::shown && record.window.type <= window_event::focus_lost;
+                break;
+            default:
+                valid = false;
+                break;
+            }
+            return valid;
+        }
+
+#ifdef __linux__
+        // layout of the shared-memory transport, one attached client at a time: a handshake word
+        // the client waits on for connect and disconnect, and a single-producer ring of event
+        // records the server drains, with a futex word the server sleeps on when the ring is empty
+        struct shm_segment
+        {
+            static const uint32_t magic_value = 0x6e707574;
+            static constexpr uint64_t capacity = 4096;
+            static constexpr uint32_t message_capacity = 1024;
+
+            static const uint32_t idle = 0;
+            static const uint32_t connect_requested = 1;
+            static const uint32_t connected = 2;
+            static const uint32_t rejected = 3;
+            static const uint32_t disconnect_requested = 4;
+            static const uint32_t disconnected = 5;
+
+            std::atomic<uint32_t> magic;
+            // pid of the serving process, 0 once it has shut down
+            std::atomic<int32_t> server;
+            // pid of the attached client, 0 while free
+            std::atomic<int32_t> owner;
+            std::atomic<uint32_t> state;
+            std::atomic<uint32_t> wake;
+            std::atomic<uint32_t> sleeping;
+            // user data on connect, then the session id or error written back by the server
+            uint32_t message_size;
+            char message[message_capacity];
+            alignas(64) std::atomic<uint64_t> head;
+            alignas(64) std::atomic<uint64_t> tail;
+            alignas(64) event records[capacity];
+        };
+
+        // not FUTEX_PRIVATE, the word is shared between processes
+        static void futex_wait(std::atomic<uint32_t> &word, uint32_t expected, const struct timespec *timeout = nullptr)
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAIT, expected, timeout, nullptr, 0);
+        }
+
+        // a pid that cannot be signalled only for lack of permission is still running
+        static bool process_alive(int32_t pid)
+        {
+            return pid != 0 && (kill(pid, 0) == 0 || errno != ESRCH);
+        }
+
+        static void futex_wake(std::atomic<uint32_t> &word)
+        {
+            syscall(SYS_futex, reinterpret_cast<uint32_t *>(&word), FUTEX_WAKE, INT32_MAX, nullptr, nullptr, 0);
+        }
+
+        static void wake_shm_server(shm_segment &segment)
+        {
+            segment.wake.fetch_add(1, std::memory_order_seq_cst);
+            futex_wake(segment.wake);
+        }
+
+        static shm_segment *map_shm_segment(int descriptor, const std::string &name)
+        {
+            void *mapping;
+            mapping = mmap(nullptr, sizeof(shm_segment), PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+            close(descriptor);
+            if (mapping == MAP_FAILED)
+            {
+                throw std::runtime_error("failed to map shared memory " + name);
+            }
+            return static_cast<shm_segment *>(mapping);
+        }
+
+        class shm_client
+        {
+        public:
+            shm_client(const std::string &name)
+            {
+                struct stat status;
+                const int descriptor = shm_open(name.c_str(), O_RDWR, 0);
+                if (descriptor < 0)
+                {
+                    throw std::runtime_error("failed to open shared memory " + name);
+                }
+                if (fstat(descriptor, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(shm_segment))
+                {
+                    close(descriptor);
+                    throw std::runtime_error("shared memory " + name + " is not a netput server");
+                }
+                _segment = map_shm_segment(descriptor, name);
+                if (_segment->magic.load(std::memory_order_acquire) != shm_segment::magic_value)
+                {
+                    munmap(_segment, sizeof(shm_segment));
+                    throw std::runtime_error("shared memory " + name + " is not a netput server");
+                }
+                _connected = false;
+                _cached_head = 0;
+            }
+
+            ~shm_client()
+            {
+                if (_connected)
+                {
+                    try
+                    {
+                        disconnect();
+                    }
+                    catch (const std::exception &)
+                    {
+                    }
+                }
+                munmap(_segment, sizeof(shm_segment));
+            }
+
+            void connect(const uint8_t *buffer, size_t size)
+            {
+                const int32_t self = static_cast<int32_t>(getpid());
+                int32_t owner;
+                uint32_t state;
+
+                if (size > shm_segment::message_capacity)
+                {
+                    throw std::runtime_error("connect data too large for the shared memory transport");
+                }
+                owner = 0;
+                if (!_segment->owner.compare_exchange_strong(owner, self))
+                {
+                    // a client that died without disconnecting leaves its pid behind
+                    if (owner == self || process_alive(owner) || !_segment->owner.compare_exchange_strong(owner, self))
+                    {
+                        throw std::runtime_error("shared memory server is busy");
+                    }
+                }
+
+                std::memcpy(_segment->message, buffer, size);
+                _segment->message_size = static_cast<uint32_t>(size);
+                try
+                {
+                    state = request(shm_segment::connect_requested);
+                }
+                catch (const std::exception &)
+                {
+                    _segment->owner.store(0, std::memory_order_release);
+                    throw;
+                }
+                if (state != shm_segment::connected)
+                {
+                    const std::string error = reply();
+                    _segment->owner.store(0, std::memory_order_release);
+                    throw std::runtime_error("error returned from server: " + error);
+                }
+                _cached_head = _segment->head.load(std::memory_order_acquire);
+                _connected = true;
+            }
+
+            void disconnect()
+            {
+                require_connected();
+                _connected = false;
+                try
+                {
+                    request(shm_segment::disconnect_requested);
+                }
+                catch (const std::exception &)
+                {
+                    _segment->owner.store(0, std::memory_order_release);
+                    throw;
+                }
+                const std::string error = reply();
+                _segment->owner.store(0, std::memory_order_release);
+                if (!error.empty())
+                {
+                    throw std::runtime_error("error returned from server: " + error);
+                }
+            }
+
+            void send(const event &record)
+            {
+                const uint64_t tail = _segment->tail.load(std::memory_order_relaxed);
+                size_t spins;
+                require_connected();
+                spins = 0;
+                while (tail - _cached_head >= shm_segment::capacity)
+                {
+                    _cached_head = _segment->head.load(std::memory_order_acquire);
+                    if (tail - _cached_head >= shm_segment::capacity)
+                    {
+                        wake_shm_server(*_segment);
+                        std::this_thread::yield();
+                        check_server(++spins);
+                    }
+                }
+                _segment->records[tail & (shm_segment::capacity - 1)] = record;
+                _segment->tail.store(tail + 1, std::memory_order_release);
+                // pairs with the fence the server issues between raising sleeping and rechecking the ring
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if (_segment->sleeping.load(std::memory_order_relaxed) != 0)
+                {
+                    wake_shm_server(*_segment);
+                }
+            }
+
+            // returns once the server has taken every record out of the ring
+            void flush()
+            {
+                const uint64_t tail = _segment->tail.load(std::memory_order_relaxed);
+                size_t spins;
+                spins = 0;
+                while (_segment->head.load(std::memory_order_acquire) != tail)
+                {
+                    std::this_thread::yield();
+                    check_server(++spins);
+                }
+            }
+
+        private:
+            // how often a client that keeps waiting on the server checks it is still there
+            static constexpr size_t liveness_spins = 4096;
+            static constexpr long liveness_interval_ns = 100000000;
+
+            // throws once the serving process is gone, nothing would ever drain the ring or answer
+            void check_server(size_t spins) const
+            {
+                if (spins % liveness_spins == 0 && !process_alive(_segment->server.load(std::memory_order_acquire)))
+                {
+                    throw std::runtime_error("shared memory server is not running");
+                }
+            }
+
+            void require_connected() const
+            {
+                if (!_connected)
+                {
+                    throw std::runtime_error("client is not connected");
+                }
+            }
+
+            std::string reply() const
+            {
+                return std::string(_segment->message, std::min<uint32_t>(_segment->message_size, shm_segment::message_capacity));
+            }
+
+            // publishes a request after every record sent before it and waits for the server's answer
+            uint32_t request(uint32_t requested)
+            {
+                const struct timespec interval = {0, liveness_interval_ns};
+                uint32_t state;
+                _segment->state.store(requested, std::memory_order_seq_cst);
+                wake_shm_server(*_segment);
+                state = _segment->state.load(std::memory_order_acquire);
+                while (state == requested)
+                {
+                    futex_wait(_segment->state, requested, &interval);
+                    state = _segment->state.load(std::memory_order_acquire);
+                    if (state == requested)
+                    {
+                        check_server(0);
+                    }
+                }
+                return state;
+            }
+
+            shm_segment *_segment;
+            bool _connected;
+            uint64_t _cached_head;
+        };
+
+        class shm_server
+        {
+        public:
+            shm_server(const std::string &name) : _name(name)
+            {
+                int descriptor;
+                if (serving(name))
+                {
+                    throw std::runtime_error("shared memory " + name + " is in use by a running server");
+                }
+                // a segment left behind by a server that did not shut down cleanly
+                shm_unlink(name.c_str());
+                descriptor = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+                if (descriptor < 0)
+                {
+                    throw std::runtime_error("failed to create shared memory " + name);
+                }
+                if (ftruncate(descriptor, sizeof(shm_segment)) != 0)
+                {
+                    close(descriptor);
+                    shm_unlink(name.c_str());
+                    throw std::runtime_error("failed to size shared memory " + name);
+                }
+                _segment = new (map_shm_segment(descriptor, name)) shm_segment;
+                _segment->server.store(static_cast<int32_t>(getpid()), std::memory_order_relaxed);
+                _segment->owner.store(0, std::memory_order_relaxed);
+                _segment->state.store(shm_segment::idle, std::memory_order_relaxed);
+                _segment->wake.store(0, std::memory_order_relaxed);
+                _segment->sleeping.store(0, std::memory_order_relaxed);
+                _segment->message_size = 0;
+                _segment->head.store(0, std::memory_order_relaxed);
+                _segment->tail.store(0, std::memory_order_relaxed);
+                _segment->magic.store(shm_segment::magic_value, std::memory_order_release);
+                _running.store(true);
+            }
+
+            ~shm_server()
+            {
+                // a client still attached stops waiting on us
+                _segment->server.store(0, std::memory_order_release);
+                futex_wake(_segment->state);
+                munmap(_segment, sizeof(shm_segment));
+                shm_unlink(_name.c_str());
+            }
+
+            // drains the ring on the calling thread until stop(), spinning briefly before sleeping so
+            // a steady stream is picked up without a futex round trip
+            void run(
+                const std::function<bool(const uint8_t *, size_t, std::string &)> &connect_handler,
+                const std::function<void(event *, size_t)> &events_handler,
+                const std::function<bool()> &disconnect_handler)
+            {
+                std::vector<event> records(drain_limit);
+                std::vector<uint8_t> user_data(shm_segment::message_capacity);
+                std::string message;
+                uint32_t state;
+                uint32_t observed;
+                uint32_t size;
+                size_t count;
+                size_t spins;
+                bool success;
+
+                spins = 0;
+                while (_running.load(std::memory_order_acquire))
+                {
+                    count = pop(records.data(), records.size());
+                    if (count > 0)
+                    {
+                        events_handler(records.data(), count);
+                        spins = 0;
+                        continue;
+                    }
+
+                    state = _segment->state.load(std::memory_order_acquire);
+                    if (state == shm_segment::connect_requested)
+                    {
+                        // read once, the client could change it while it is being copied
+                        size = _segment->message_size;
+                        if (size > shm_segment::message_capacity)
+                        {
+                            respond(shm_segment::rejected, "connect data too large");
+                            continue;
+                        }
+                        std::memcpy(user_data.data(), _segment->message, size);
+                        message.clear();
+                        success = connect_handler(user_data.data(), size, message);
+                        respond(success ? shm_segment::connected : shm_segment::rejected, message);
+                    }
+                    else if (state == shm_segment::disconnect_requested)
+                    {
+                        // every record the client sent before asking is visible now
+                        while ((count = pop(records.data(), records.size())) > 0)
+                        {
+                            events_handler(records.data(), count);
+                        }
+                        success = disconnect_handler();
+                        respond(shm_segment::disconnected, success ? std::string() : std::string("disconnect failed"));
+                    }
+                    else if (spins < spin_limit)
+                    {
+                        spins++;
+                    }
+                    else
+                    {
+                        observed = _segment->wake.load(std::memory_order_acquire);
+                        _segment->sleeping.store(1, std::memory_order_relaxed);
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        state = _segment->state.load(std::memory_order_relaxed);
+                        if (_segment->tail.load(std::memory_order_relaxed) == _segment->head.load(std::memory_order_relaxed) &&
+                            state != shm_segment::connect_requested &&
+                            state != shm_segment::disconnect_requested &&
+                            _running.load(std::memory_order_acquire))
+                        {
+                            futex_wait(_segment->wake, observed);
+                        }
+                        _segment->sleeping.store(0, std::memory_order_relaxed);
+                        spins = 0;
+                    }
+                }
+            }
+
+            void stop()
+            {
+                _running.store(false, std::memory_order_release);
+                wake_shm_server(*_segment);
+            }
+
+        private:
+            static const size_t drain_limit = 256;
+
+            // true while the process that created the segment at name is still running
+            static bool serving(const std::string &name)
+            {
+                struct stat status;
+                shm_segment *segment;
+                bool result;
+                const int descriptor = shm_open(name.c_str(), O_RDWR, 0);
+                if (descriptor < 0)
+                {
+                    return false;
+                }
+                if (fstat(descriptor, &status) != 0 || static_cast<size_t>(status.st_size) < sizeof(shm_segment))
+                {
+                    close(descriptor);
+                    return false;
+                }
+                segment = map_shm_segment(descriptor, name);
+                result = segment->magic.load(std::memory_order_acquire) == shm_segment::magic_value &&
+                         process_alive(segment->server.load(std::memory_order_acquire));
+                munmap(segment, sizeof(shm_segment));
+                return result;
+            }
+            static const size_t spin_limit = 4096;
+
+            size_t pop(event *values, size_t max)
+            {
+                const uint64_t head = _segment->head.load(std::memory_order_relaxed);
+                const uint64_t available = _segment->tail.load(std::memory_order_acquire) - head;
+                const size_t count = static_cast<size_t>(std::min<uint64_t>(available, max));
+                for (size_t index = 0; index < count; index++)
+                {
+                    values[index] = _segment->records[(head + index) & (shm_segment::capacity - 1)];
+                }
+                _segment->head.store(head + count, std::memory_order_release);
+                return count;
+            }
+
+            void respond(uint32_t state, const std::string &message)
+            {
+                const size_t size = std::min<size_t>(message.size(), shm_segment::message_capacity);
+                std::memcpy(_segment->message, message.data(), size);
+                _segment->message_size = static_cast<uint32_t>(size);
+                _segment->state.store(state, std::memory_order_release);
+                futex_wake(_segment->state);
+            }
+
+            const std::string _name;
+            shm_segment *_segment;
+            std::atomic<bool> _running;
+        };
+#else
+        class shm_client
+        {
+        public:
+            shm_client(const std::string &)
+            {
+                throw std::runtime_error("the shared memory transport is only available on linux");
+            }
+
+            void connect(const uint8_t *, size_t)
+            {
+            }
+
+            void disconnect()
+            {
+            }
+
+            void send(const event &)
+            {
+            }
+
+            void flush()
+            {
+            }
+        };
+
+        class shm_server
+        {
+        public:
+            shm_server(const std::string &)
+            {
+                throw std::runtime_error("the shared memory transport is only available on linux");
+            }
+
+            void run(
+                const std::function<bool(const uint8_t *, size_t, std::string &)> &,
+                const std::function<void(event *, size_t)> &,
+                const std::function<bool()> &)
+            {
+            }
+
+            void stop()
+            {
+            }
+        };
+#endif
+
+        class service final : public netput::rpc::Netput::Server
+        {
+        public:
+            service(
+                const std::function<void(const rpc::ConnectRequest::Reader &, rpc::ConnectResponse::Builder &)> &connect_handler,
+                const std::function<void(const rpc::Event::Reader &)> &push_handler,
+                const std::function<void(const rpc::DisconnectRequest::Reader &, rpc::DisconnectResponse::Builder &)> &disconnect_handler,
+                const std::function<void(const rpc::EventBatch::Reader &)> &push_batch_handler,
+                const std::function<kj::Promise<void>(const rpc::DisconnectRequest::Reader &)> &drain_handler) : _connect_handler(connect_handler),
+                                                                                                                 _push_handler(push_handler),
+                                                                                                                 _disconnect_handler(disconnect_handler),
+                                                                                                                 _push_batch_handler(push_batch_handler),
+                                                                                                                 _drain_handler(drain_handler)
+            {
+            }
+
+            kj::Promise<void> connect(netput::rpc::Netput::Server::ConnectContext context) override
+            {
+                const netput::rpc::ConnectRequest::Reader reader = context.getParams().getRequest();
+                netput::rpc::ConnectResponse::Builder builder = context.getResults().initResponse();
+                _connect_handler(reader, builder);
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> push(netput::rpc::Netput::Server::PushContext context) override
+            {
+                const netput::rpc::Event::Reader reader = context.getParams().getEvent();
+                _push_handler(reader);
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> disconnect(netput::rpc::Netput::Server::DisconnectContext context) override
+            {
+                // the disconnect handler must not overtake events of the session still queued on a worker
+                return _drain_handler(context.getParams().getRequest()).then(
+                    [this, context]() mutable
+                    {
+                        const netput::rpc::DisconnectRequest::Reader reader = context.getParams().getRequest();
+                        netput::rpc::DisconnectResponse::Builder builder = context.getResults().initResponse();
+                        _disconnect_handler(reader, builder);
+                    });
+            }
+
+            kj::Promise<void> pushStream(netput::rpc::Netput::Server::PushStreamContext context) override
+            {
+                const netput::rpc::Event::Reader reader = context.getParams().getEvent();
+                _push_handler(reader);
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> pushBatch(netput::rpc::Netput::Server::PushBatchContext context) override
+            {
+                const netput::rpc::EventBatch::Reader reader = context.getParams().getBatch();
+                _push_batch_handler(reader);
+                return kj::READY_NOW;
+            }
+
+        private:
+            std::function<void(const rpc::ConnectRequest::Reader &, rpc::ConnectResponse::Builder &)> _connect_handler;
+            std::function<void(const rpc::Event::Reader &)> _push_handler;
+            std::function<void(const rpc::DisconnectRequest::Reader &, rpc::DisconnectResponse::Builder &)> _disconnect_handler;
+            std::function<void(const rpc::EventBatch::Reader &)> _push_batch_handler;
+            std::function<kj::Promise<void>(const rpc::DisconnectRequest::Reader &)> _drain_handler;
+        };
+
+        // one per connect, i/o thread only. reliable counts the events that arrived over the stream,
+        // a datagram that overtook stream events sent before it waits in parked until they arrive
+        struct connection
+        {
+            const session_entry *entry;
+            uint64_t token;
+            uint64_t reliable;
+            datagram_decoder decoder;
+            bool parked;
+            uint64_t parked_epoch;
+            event parked_event;
+        };
+
+        class session final : public netput::rpc::Session::Server
+        {
+        public:
+            session(
+                const session_entry &entry,
+                uint64_t token,
+                size_t parity_group,
+                const std::function<void(connection &, const rpc::Event::Info::Reader &)> &info_handler,
+                const std::function<void(connection &, const capnp::List<rpc::Event>::Reader &)> &events_handler,
+                const std::function<void(connection &)> &close_handler) : _info_handler(info_handler),
+                                                                          _events_handler(events_handler),
+                                                                          _close_handler(close_handler)
+            {
+                _connection.entry = &entry;
+                _connection.token = token;
+                _connection.reliable = 0;
+                _connection.decoder.reset(parity_group);
+                _connection.parked = false;
+                _connection.parked_epoch = 0;
+            }
+
+            ~session()
+            {
+                _close_handler(_connection);
+            }
+
+            connection &get_connection()
+            {
+                return _connection;
+            }
+
+            void receive(const rpc::Event::Info::Reader &info)
+            {
+                _info_handler(_connection, info);
+            }
+
+            void receive(const capnp::List<rpc::Event>::Reader &events)
+            {
+                _events_handler(_connection, events);
+            }
+
+            kj::Promise<void> push(netput::rpc::Session::Server::PushContext context) override
+            {
+                receive(context.getParams().getEvent().getInfo());
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> pushBatch(netput::rpc::Session::Server::PushBatchContext context) override
+            {
+                receive(context.getParams().getEvents());
+                return kj::READY_NOW;
+            }
+
+            kj::Promise<void> pushStream(netput::rpc::Session::Server::PushStreamContext context) override
+            {
+                receive(context.getParams().getEvent().getInfo());
+                return kj::READY_NOW;
+            }
+
+        private:
+            connection _connection;
+            std::function<void(connection &, const rpc::Event::Info::Reader &)> _info_handler;
+            std::function<void(connection &, const capnp::List<rpc::Event>::Reader &)> _events_handler;
+            std::function<void(connection &)> _close_handler;
+        };
+
+        class server
+        {
+        public:
+            server(const std::string &address)
+            {
+                _address = address;
+                _datagrams = false;
+                if (is_shm_address(address))
+                {
+                    _shm = std::make_unique<shm_server>(address.substr(4));
+                    return;
+                }
+                remove_stale_socket(address);
+                const auto connect_handler = [&](const rpc::ConnectRequest::Reader &reader, rpc::ConnectResponse::Builder &builder)
+                {
+                    this->handle_connect(reader, builder);
+                };
+                const auto push_handler = [&](const rpc::Event::Reader &reader)
+                {
+                    this->handle_push(reader);
+                };
+                const auto disconnect_handler = [&](const rpc::DisconnectRequest::Reader &reader, rpc::DisconnectResponse::Builder &builder)
+                {
+                    this->handle_disconnect(reader, builder);
+                };
+                const auto push_batch_handler = [&](const rpc::EventBatch::Reader &reader)
+                {
+                    this->handle_push_batch(reader);
+                };
+                const auto drain_handler = [&](const rpc::DisconnectRequest::Reader &reader)
+                {
+                    return this->drain(reader.getSessionId());
+                };
+                _rpc_server = std::make_unique<capnp::EzRpcServer>(
+                    kj::heap<service>(connect_handler, push_handler, disconnect_handler, push_batch_handler, drain_handler), address);
+                // made here rather than in serve() so a shutdown() from any thread, even one that comes
+                // before serve(), is never lost
+                _promise_fulfiller = kj::heap<kj::PromiseCrossThreadFulfillerPair<void>>(
+                    kj::newPromiseAndCrossThreadFulfiller<void>());
+            }
+
+            ~server()
+            {
+                shutdown();
+                // the promise belongs to the event loop the rpc server owns
+                _promise_fulfiller = nullptr;
+                // sessions still held by the rpc system unregister their channels on destruction
+                _rpc_server.reset();
+            }
+
+            void serve()
+            {
+                if (_shm)
+                {
+                    serve_shm();
+                    return;
+                }
+                kj::WaitScope &wait_scope = _rpc_server->getWaitScope();
+                if (_datagrams && !is_unix_address(_address))
+                {
+                    open_datagrams(wait_scope);
+                }
+                _promise_fulfiller->promise.wait(wait_scope);
+                // the socket has to go before the event loop it is registered with
+                _receive_task = nullptr;
+                _datagram_receiver = nullptr;
+                _datagram_port = nullptr;
+                _rpc_server.reset();
+            }
+
+            void shutdown()
+            {
+                if (_shm)
+                {
+                    _shm->stop();
+                }
+                else if (_promise_fulfiller.get() != nullptr)
+                {
+                    _promise_fulfiller->fulfiller->fulfill();
+                }
+            }
+
+            void set_workers(size_t count)
+            {
+                const auto dispatch_handler = [this](const session_entry &session, const event &record)
+                {
+                    this->dispatch(session.id, &record, 1);
+                };
+                const auto error_handler = [this](const std::string &message)
+                {
+                    this->report_error(message);
+                };
+                _workers.reset();
+                if (count > 0)
+                {
+                    _workers = std::make_unique<worker_pool>(count, dispatch_handler, error_handler);
+                }
+            }
+
+            std::vector<worker_stats> get_worker_stats() const
+            {
+                std::vector<worker_stats> result;
+                if (_workers)
+                {
+                    result = _workers->stats();
+                }
+                return result;
+            }
+
+            void set_polling(size_t capacity)
+            {
+                _events.reset();
+                if (capacity > 0)
+                {
+                    _events = std::make_unique<spsc_queue<event>>(capacity);
+                }
+            }
+
+            size_t poll(event *events, size_t max)
+            {
+                return _events ? _events->try_pop(events, max) : 0;
+            }
+
+            uint64_t dropped_events() const
+            {
+                return _dropped_events.load(std::memory_order_relaxed);
+            }
+
+            // takes effect on the next serve(), the port is bound on the event loop thread
+            void set_udp(bool enabled)
+            {
+                _datagrams = enabled;
+            }
+
+            // sessions seen before tracking was turned on stay untracked
+            void set_input_tracking(bool enabled)
+            {
+                std::lock_guard<std::mutex> lock(_sessions_mutex);
+                _tracking = enabled;
+            }
+
+            // only the lookup is under the sessions lock, the tracker is read after it is released so
+            // opening or closing a session never waits for a read to finish
+            bool get_input_state(const std::string &session_id, input_snapshot &state) const
+            {
+                std::shared_ptr<const input_tracker> tracker;
+                {
+                    std::lock_guard<std::mutex> lock(_sessions_mutex);
+                    const auto found = _session_numbers.find(session_id);
+                    if (found != _session_numbers.end())
+                    {
+                        tracker = _sessions[slot_of(found->second)]->input;
+                    }
+                }
+                if (tracker)
+                {
+                    tracker->read(state);
+                }
+                return tracker != nullptr;
+            }
+
+            void set_recording(const std::string &path)
+            {
+                _recorder.reset();
+                if (!path.empty())
+                {
+                    _recorder = std::make_unique<recorder>(
+                        path,
+                        [this](const std::string &message)
+                        {
+                            this->report_error(message);
+                        });
+                }
+            }
+
+            uint64_t dropped_datagrams() const
+            {
+                return _dropped_datagrams.load(std::memory_order_relaxed);
+            }
+
+            uint64_t recovered_datagrams() const
+            {
+                return _recovered_datagrams.load(std::memory_order_relaxed);
+            }
+
+            // safe from any thread
+            server_stats stats() const
+            {
+                server_stats result;
+                // closed first, a session cannot close before it opened
+                const uint64_t closed = _sessions_closed.get();
+                for (size_t index = 0; index < event_type_count; index++)
+                {
+                    result.events[index] = _received[index].get();
+                }
+                result.bytes = _bytes.get();
+                result.sessions = _sessions_opened.get() - closed;
+                result.queue_depth = _events ? _events->size() : 0;
+                result.dropped_events = dropped_events();
+                result.dropped_datagrams = dropped_datagrams();
+                result.recovered_datagrams = recovered_datagrams();
+                result.handler_ns = _handler_ns.get();
+                for (const worker_stats &entry : get_worker_stats())
+                {
+                    result.queue_depth += entry.queue_depth;
+                    result.handler_ns += entry.handler_ns;
+                }
+                return result;
+            }
+
+            std::string session_id(uint32_t session) const
+            {
+                std::lock_guard<std::mutex> lock(_sessions_mutex);
+                const size_t slot = slot_of(session);
+                return (slot < _sessions.size() && _sessions[slot] && _sessions[slot]->number == session) ? _sessions[slot]->id : std::string();
+            }
+
+            // the capability a connect hands out, every push on it lands in the session's entry
+            kj::Own<session> open_session(const std::string &session_id, uint64_t token, size_t parity_group)
+            {
+                const auto info_handler = [this](connection &channel, const rpc::Event::Info::Reader &info)
+                {
+                    this->handle_info(*channel.entry, info);
+                    channel.reliable++;
+                    this->release_parked(channel);
+                };
+                const auto events_handler = [this](connection &channel, const capnp::List<rpc::Event>::Reader &events)
+                {
+                    this->handle_events(*channel.entry, events);
+                    channel.reliable += events.size();
+                    this->release_parked(channel);
+                };
+                const auto close_handler = [this](connection &channel)
+                {
+                    if (channel.token != 0)
+                    {
+                        this->_channels.erase(channel.token);
+                    }
+                    this->drop_session(*channel.entry);
+                    this->_sessions_closed.add(1);
+                };
+                _sessions_opened.add(1);
+                return kj::heap<session>(hold_session(session_id), token, parity_group, info_handler, events_handler, close_handler);
+            }
+
+            void handle_connect(
+                const netput::rpc::ConnectRequest::Reader &reader,
+                netput::rpc::ConnectResponse::Builder &builder)
+            {
+                const uint8_t *user_data_buffer;
+                size_t user_data_size;
+                std::pair<bool, std::string> result;
+                uint64_t token;
+                size_t parity_group;
+
+                if (reader.hasUserData())
+                {
+                    const capnp::Data::Reader &user_data = reader.getUserData();
+                    user_data_buffer = user_data.begin();
+                    user_data_size = user_data.size();
+                }
+                else
+                {
+                    user_data_buffer = nullptr;
+                    user_data_size = 0;
+                }
+
+                result = accept(user_data_buffer, user_data_size);
+                if (result.first)
+                {
+                    if (_recorder)
+                    {
+                        _recorder->record_connect(capnp::Text::Reader(result.second.data(), result.second.size()), user_data_buffer, user_data_size);
+                    }
+                    token = (reader.getDatagrams() && _datagram_port.get() != nullptr) ? next_token() : 0;
+                    // groups the decoder cannot track are left without parity, their parity datagrams are dropped
+                    parity_group = (reader.getParityGroup() <= max_parity_group) ? reader.getParityGroup() : 0;
+                    builder.initMessage().setSessionId(result.second);
+                    kj::Own<session> server_session = open_session(result.second, token, parity_group);
+                    if (token != 0)
+                    {
+                        _channels.emplace(token, &server_session->get_connection());
+                        builder.setDatagramPort(static_cast<uint16_t>(_datagram_port->getPort()));
+                        builder.setDatagramToken(token);
+                    }
+                    builder.setSession(kj::mv(server_session));
+                }
+                else
+                {
+                    builder.initMessage().setError(result.second);
+                }
+            }
+
+            void handle_push(const netput::rpc::Event::Reader &reader)
+            {
+                handle_info(intern_session(reader.getSessionId()), reader.getInfo());
+            }
+
+            void handle_push_batch(const netput::rpc::EventBatch::Reader &reader)
+            {
+                handle_events(intern_session(reader.getSessionId()), reader.getEvents());
+            }
+
+            void handle_disconnect(
+                const netput::rpc::DisconnectRequest::Reader &reader,
+                netput::rpc::DisconnectResponse::Builder &builder)
+            {
+                bool success;
+                success = true;
+                if (_recorder && reader.hasSessionId())
+                {
+                    _recorder->record_disconnect(reader.getSessionId());
+                }
+                if (_disconnect_handler)
+                {
+                    if (reader.hasSessionId())
+                    {
+                        success = _disconnect_handler(reader.getSessionId());
+                    }
+                    else
+                    {
+                        success = false;
+                    }
+                }
+
+                if (reader.hasSessionId())
+                {
+                    close_session(reader.getSessionId());
+                }
+
+                if (!success)
+                {
+                    builder.setError("disconnect failed");
+                }
+            }
+
+            // TODO: maybe move these, probably not
             std::function<std::pair<bool, std::string>(const uint8_t *, size_t)> _connect_handler;
             std::function<bool(const std::string &)> _disconnect_handler;
             std::function<void(const std::string &, uint64_t, uint32_t, input_state, bool, uint32_t)> _keyboard_handler;
@@ -462,160 +3724,899 @@ namespace netput
             std::function<void(const std::string &, uint64_t, uint32_t, mouse_button, input_state, bool, int32_t, int32_t)> _mouse_button_handler;
             std::function<void(const std::string &, uint64_t, uint32_t, int32_t, int32_t, float, float)> _mouse_wheel_handler;
             std::function<void(const std::string &, uint64_t, uint32_t, window_event, int32_t, int32_t)> _window_handler;
+            std::function<void(const event *, size_t)> _events_handler;
+            std::function<void(const std::string &)> _error_handler;
+
+        private:
+            std::pair<bool, std::string> accept(const uint8_t *buffer, size_t size)
+            {
+                std::pair<bool, std::string> result;
+                if (_connect_handler)
+                {
+                    result = _connect_handler(buffer, size);
+                }
+                else
+                {
+                    result.first = false;
+                    result.second = "unimplemented connection handler";
+                }
+                return result;
+            }
+
+            // called from the serve() thread, a worker or the recorder thread
+            void report_error(const std::string &message)
+            {
+                if (_error_handler)
+                {
+                    _error_handler(message);
+                }
+            }
+
+            // the shared-memory transport runs its whole loop on the serve() thread, like the rpc event loop
+            void serve_shm()
+            {
+                const session_entry *current;
+                current = nullptr;
+                const auto disconnect_handler = [&]()
+                {
+                    bool success;
+                    success = true;
+                    if (current != nullptr)
+                    {
+                        if (_workers)
+                        {
+                            _workers->wait(current->id);
+                        }
+                        if (_disconnect_handler)
+                        {
+                            success = _disconnect_handler(current->id);
+                        }
+                        if (_recorder)
+                        {
+                            _recorder->record_disconnect(capnp::Text::Reader(current->id.data(), current->id.size()));
+                        }
+                        close_session(current->id);
+                        _sessions_closed.add(1);
+                    }
+                    current = nullptr;
+                    return success;
+                };
+                const auto connect_handler = [&](const uint8_t *buffer, size_t size, std::string &message)
+                {
+                    std::pair<bool, std::string> result;
+                    // a client that died while connected is replaced by the next one
+                    disconnect_handler();
+                    result = accept(buffer, size);
+                    if (result.first)
+                    {
+                        current = &intern_session(result.second);
+                        reset_input(*current);
+                        _sessions_opened.add(1);
+                        if (_recorder)
+                        {
+                            _recorder->record_connect(capnp::Text::Reader(current->id.data(), current->id.size()), buffer, size);
+                        }
+                    }
+                    message = result.second;
+                    return result.first;
+                };
+                const auto events_handler = [&](event *events, size_t count)
+                {
+                    size_t kept;
+                    if (current != nullptr)
+                    {
+                        _bytes.add(count * sizeof(event));
+                        kept = 0;
+                        for (size_t index = 0; index < count; index++)
+                        {
+                            if (valid_shm_record(events[index]))
+                            {
+                                events[kept] = events[index];
+                                events[kept].session = current->number;
+                                kept++;
+                            }
+                        }
+                        if (kept > 0)
+                        {
+                            deliver(*current, events, kept);
+                        }
+                    }
+                };
+                _shm->run(connect_handler, events_handler, disconnect_handler);
+            }
+
+            void open_datagrams(kj::WaitScope &wait_scope)
+            {
+                const auto report = [this](kj::Exception &&exception)
+                {
+                    this->report_error(std::string("udp receive failed: ") + exception.getDescription().cStr());
+                };
+                try
+                {
+                    _datagram_port = resolve_datagram_address(_rpc_server->getIoProvider().getNetwork(), address_host(_address), 0).wait(wait_scope)->bindDatagramPort();
+                    _datagram_receiver = _datagram_port->makeReceiver();
+                    _receive_task = receive_datagrams().eagerlyEvaluate(report);
+                }
+                catch (const kj::Exception &exception)
+                {
+                    // connects are then answered without a port and clients stay on the stream
+                    report_error(std::string("udp side channel unavailable: ") + exception.getDescription().cStr());
+                    _datagram_port = nullptr;
+                }
+            }
+
+            kj::Promise<void> receive_datagrams()
+            {
+                return _datagram_receiver->receive().then(
+                    [this]()
+                    {
+                        const auto content = _datagram_receiver->getContent();
+                        if (content.isTruncated)
+                        {
+                            _dropped_datagrams.fetch_add(1, std::memory_order_relaxed);
+                        }
+                        else
+                        {
+                            handle_datagram(content.value);
+                        }
+                        return receive_datagrams();
+                    });
+            }
+
+            void handle_datagram(const kj::ArrayPtr<const kj::byte> &bytes)
+            {
+                size_t dropped;
+
+                _bytes.add(bytes.size());
+                dropped = 1;
+                if (bytes.size() % sizeof(capnp::word) == 0 && reinterpret_cast<uintptr_t>(bytes.begin()) % alignof(capnp::word) == 0)
+                {
+                    try
+                    {
+                        capnp::FlatArrayMessageReader message(kj::arrayPtr(reinterpret_cast<const capnp::word *>(bytes.begin()), bytes.size() / sizeof(capnp::word)));
+                        const netput::rpc::Datagram::Reader datagram = message.getRoot<netput::rpc::Datagram>();
+                        const auto found = _channels.find(datagram.getToken());
+                        if (found != _channels.end())
+                        {
+                            connection &channel = *found->second;
+                            const uint64_t recovered = channel.decoder.recovered();
+                            dropped = channel.decoder.receive(
+                                bytes,
+                                datagram,
+                                [this, &channel](uint64_t, uint64_t epoch, const event &record)
+                                {
+                                    this->accept_datagram(channel, epoch, record);
+                                });
+                            _recovered_datagrams.fetch_add(channel.decoder.recovered() - recovered, std::memory_order_relaxed);
+                        }
+                    }
+                    catch (const kj::Exception &)
+                    {
+                        dropped = 1;
+                    }
+                    catch (const std::exception &)
+                    {
+                        dropped = 1;
+                    }
+                }
+                if (dropped > 0)
+                {
+                    _dropped_datagrams.fetch_add(dropped, std::memory_order_relaxed);
+                }
+            }
+
+            // the decoder hands datagrams on in sequence order, one is delivered only if it was sent
+            // after every stream event already delivered, so across both channels a session's events
+            // are delivered in the order they were sent with lost and late motion left out
+            void accept_datagram(connection &channel, uint64_t epoch, const event &record)
+            {
+                if (epoch < channel.reliable)
+                {
+                    _dropped_datagrams.fetch_add(1, std::memory_order_relaxed);
+                    return;
+                }
+                // a newer datagram supersedes the parked one, delivering both would reorder them
+                if (channel.parked)
+                {
+                    channel.parked = false;
+                    _dropped_datagrams.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (epoch == channel.reliable)
+                {
+                    deliver(*channel.entry, &record, 1);
+                }
+                else
+                {
+                    channel.parked = true;
+                    channel.parked_epoch = epoch;
+                    channel.parked_event = record;
+                }
+            }
+
+            // runs after stream events were delivered, a parked datagram whose epoch was skipped
+            // belongs between events of a batch that is already out and is dropped
+            void release_parked(connection &channel)
+            {
+                if (channel.parked && channel.parked_epoch <= channel.reliable)
+                {
+                    channel.parked = false;
+                    if (channel.parked_epoch == channel.reliable)
+                    {
+                        deliver(*channel.entry, &channel.parked_event, 1);
+                    }
+                    else
+                    {
+                        _dropped_datagrams.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            }
+
+            uint64_t next_token()
+            {
+                uint64_t token;
+                do
+                {
+                    token = _token_generator();
+                } while (token == 0 || _channels.find(token) != _channels.end());
+                return token;
+            }
+
+            void handle_info(
+                const session_entry &session,
+                const netput::rpc::Event::Info::Reader &info)
+            {
+                event record;
+                _bytes.add(info.totalSize().wordCount * sizeof(capnp::word));
+                if (read_event_info(info, record))
+                {
+                    record.session = session.number;
+                    deliver(session, &record, 1);
+                }
+            }
+
+            void handle_events(
+                const session_entry &session,
+                const capnp::List<netput::rpc::Event>::Reader &events)
+            {
+                size_t count;
+                count = 0;
+                _bytes.add(events.totalSize().wordCount * sizeof(capnp::word));
+                // only ever grows, so a steady stream of batches decodes without allocating
+                if (_decoded.size() < events.size())
+                {
+                    _decoded.resize(events.size());
+                }
+                for (const netput::rpc::Event::Reader event : events)
+                {
+                    if (read_event_info(event.getInfo(), _decoded[count]))
+                    {
+                        _decoded[count].session = session.number;
+                        count++;
+                    }
+                }
+                deliver(session, _decoded.data(), count);
+            }
+
+            void deliver(const session_entry &session, const event *events, size_t count)
+            {
+                uint64_t started;
+                for (size_t index = 0; index < count; index++)
+                {
+                    _received[static_cast<size_t>(events[index].type)].add(1);
+                }
+                if (_recorder)
+                {
+                    _recorder->record_events(session, events, count);
+                }
+                if (session.input)
+                {
+                    session.input->update(events, count);
+                }
+                if (_events)
+                {
+                    for (size_t index = 0; index < count; index++)
+                    {
+                        if (!_events->try_push(events[index]))
+                        {
+                            _dropped_events.fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                }
+                else if (_workers)
+                {
+                    for (size_t index = 0; index < count; index++)
+                    {
+                        _workers->push(session, events[index]);
+                    }
+                }
+                else
+                {
+                    started = monotonic_ns();
+                    dispatch(session.id, events, count);
+                    _handler_ns.add(monotonic_ns() - started);
+                }
+            }
 
-        private:
-            void handle_mouse_motion(
-                const std::string &session_id,
-                const netput::rpc::MouseMotionEvent::Reader &reader)
+            const session_entry &intern_session(const std::string &session_id)
+            {
+                std::lock_guard<std::mutex> lock(_sessions_mutex);
+                return find_session(session_id);
+            }
+
+            // the entry of a session capability, kept until the capability is dropped
+            const session_entry &hold_session(const std::string &session_id)
+            {
+                std::lock_guard<std::mutex> lock(_sessions_mutex);
+                session_entry &entry = find_session(session_id);
+                entry.references++;
+                reset_input(entry);
+                return entry;
+            }
+
+            // a connect starts the id over, keys held when it last went away are not held now
+            static void reset_input(const session_entry &entry)
+            {
+                if (entry.input)
+                {
+                    entry.input->reset();
+                }
+            }
+
+            // a disconnect ends the id's session, its entry goes now or with its last capability
+            void close_session(const std::string &session_id)
+            {
+                std::unique_ptr<session_entry> closed;
+                {
+                    std::lock_guard<std::mutex> lock(_sessions_mutex);
+                    const auto found = _session_numbers.find(session_id);
+                    if (found != _session_numbers.end())
+                    {
+                        const size_t slot = slot_of(found->second);
+                        _session_numbers.erase(found);
+                        if (_sessions[slot]->references == 0)
+                        {
+                            closed = free_slot(slot);
+                        }
+                    }
+                }
+                retire_session(std::move(closed));
+            }
+
+            void drop_session(const session_entry &entry)
+            {
+                std::unique_ptr<session_entry> closed;
+                {
+                    std::lock_guard<std::mutex> lock(_sessions_mutex);
+                    const size_t slot = slot_of(entry.number);
+                    if (--_sessions[slot]->references == 0)
+                    {
+                        const auto found = _session_numbers.find(entry.id);
+                        if (found != _session_numbers.end() && found->second == entry.number)
+                        {
+                            _session_numbers.erase(found);
+                        }
+                        closed = free_slot(slot);
+                    }
+                }
+                retire_session(std::move(closed));
+            }
+
+            // sessions lock held
+            session_entry &find_session(const std::string &session_id)
             {
-                mouse_button_state_mask state_mask;
-                state_mask.left = input_state_from_rpc(reader.getStateMask().getLeft());
-                state_mask.middle = input_state_from_rpc(reader.getStateMask().getMiddle());
-                state_mask.right = input_state_from_rpc(reader.getStateMask().getRight());
-                state_mask.x1 = input_state_from_rpc(reader.getStateMask().getX1());
-                state_mask.x2 = input_state_from_rpc(reader.getStateMask().getX2());
-                if (_mouse_motion_handler)
+                const auto found = _session_numbers.find(session_id);
+                session_entry *entry;
+                size_t slot;
+                if (found != _session_numbers.end())
+                {
+                    entry = _sessions[slot_of(found->second)].get();
+                }
+                else
                 {
-                    _mouse_motion_handler(
-                        session_id,
-                        reader.getTimestamp(),
-                        reader.getWindowId(),
-                        state_mask,
-                        reader.getX(),
-                        reader.getY(),
-                        reader.getRelativeX(),
-                        reader.getRelativeY());
+                    if (!_free_slots.empty())
+                    {
+                        slot = _free_slots.back();
+                        _free_slots.pop_back();
+                    }
+                    else if (_sessions.size() < session_slot_mask)
+                    {
+                        slot = _sessions.size();
+                        _sessions.emplace_back();
+                        _generations.push_back(0);
+                    }
+                    else
+                    {
+                        throw std::runtime_error("too many open sessions");
+                    }
+                    _sessions[slot] = std::make_unique<session_entry>();
+                    entry = _sessions[slot].get();
+                    entry->id = session_id;
+                    entry->number = (_generations[slot] << session_slot_bits) | static_cast<uint32_t>(slot + 1);
+                    entry->hash = std::hash<std::string>()(session_id);
+                    entry->references = 0;
+                    if (_tracking)
+                    {
+                        entry->input = std::make_shared<input_tracker>();
+                    }
+                    _session_numbers.emplace(session_id, entry->number);
                 }
+                return *entry;
+            }
+
+            // sessions lock held, the slot's next session gets a number no queued event carries
+            std::unique_ptr<session_entry> free_slot(size_t slot)
+            {
+                std::unique_ptr<session_entry> entry = std::move(_sessions[slot]);
+                _generations[slot] = (_generations[slot] + 1) & session_generation_mask;
+                _free_slots.push_back(slot);
+                return entry;
             }
 
-            void handle_mouse_button(
-                const std::string &session_id,
-                const netput::rpc::MouseButtonEvent::Reader &reader)
+            // i/o thread only, a worker may still hold events that point at the entry
+            void retire_session(std::unique_ptr<session_entry> &&entry)
             {
-                if (_mouse_button_handler)
+                if (entry)
                 {
-                    _mouse_button_handler(
-                        session_id,
-                        reader.getTimestamp(),
-                        reader.getWindowId(),
-                        mouse_button_from_rpc(reader.getButton()),
-                        input_state_from_rpc(reader.getState()),
-                        reader.getDouble(),
-                        reader.getX(),
-                        reader.getY());
+                    if (_last_session == entry.get())
+                    {
+                        _last_session = nullptr;
+                    }
+                    if (_workers)
+                    {
+                        _workers->retire(std::move(entry));
+                    }
                 }
             }
 
-            void handle_mouse_wheel(
-                const std::string &session_id,
-                const netput::rpc::MouseWheelEvent::Reader &reader)
+            static size_t slot_of(uint32_t number)
             {
-                if (_mouse_wheel_handler)
+                return static_cast<size_t>(number & session_slot_mask) - 1;
+            }
+
+            // i/o thread only, a session that keeps pushing skips the lock and the std::string copy
+            const session_entry &intern_session(const capnp::Text::Reader &session_id)
+            {
+                if (_last_session == nullptr ||
+                    _last_session->id.size() != session_id.size() ||
+                    std::memcmp(_last_session->id.data(), session_id.begin(), session_id.size()) != 0)
                 {
-                    _mouse_wheel_handler(
-                        session_id,
-                        reader.getTimestamp(),
-                        reader.getWindowId(),
-                        reader.getX(),
-                        reader.getY(),
-                        reader.getPreciseX(),
-                        reader.getPreciseY());
+                    _last_session = &intern_session(std::string(session_id.begin(), session_id.size()));
                 }
+                return *_last_session;
+            }
+
+            kj::Promise<void> drain(const std::string &session_id)
+            {
+                return _workers ? _workers->barrier(session_id) : kj::Promise<void>(kj::READY_NOW);
             }
 
-            void handle_keyboard(
-                const std::string &session_id,
-                const netput::rpc::KeyboardEvent::Reader &reader)
+            void dispatch(const std::string &session_id, const event *events, size_t count)
             {
-                if (_keyboard_handler)
+                if (count > 0 && _events_handler)
+                {
+                    _events_handler(events, count);
+                }
+                for (size_t index = 0; index < count; index++)
                 {
-                    _keyboard_handler(
-                        session_id,
-                        reader.getTimestamp(),
-                        reader.getWindowId(),
-                        input_state_from_rpc(
-                            reader.getState()),
-                        reader.getRepeat(),
-                        reader.getKeyCode());
+                    dispatch(session_id, events[index]);
                 }
             }
 
-            void handle_window(
-                const std::string &session_id,
-                const netput::rpc::WindowEvent::Reader &reader)
+            void dispatch(const std::string &session_id, const event &record)
             {
-                if (_window_handler)
+                switch (record.type)
                 {
-                    _window_handler(
-                        session_id,
-                        reader.getTimestamp(),
-                        reader.getWindowId(),
-                        window_event_from_rpc(reader.getType()),
-                        reader.getArg1(),
-                        reader.getArg2());
+                case event_type::keyboard:
+                    if (_keyboard_handler)
+                    {
+                        _keyboard_handler(
+                            session_id,
+                            record.timestamp,
+                            record.window_id,
+                            record.keyboard.state,
+                            record.keyboard.repeat,
+                            record.keyboard.key_code);
+                    }
+                    break;
+                case event_type::mouse_motion:
+                    if (_mouse_motion_handler)
+                    {
+                        _mouse_motion_handler(
+                            session_id,
+                            record.timestamp,
+                            record.window_id,
+                            record.mouse_motion.state_mask,
+                            record.mouse_motion.x,
+                            record.mouse_motion.y,
+                            record.mouse_motion.relative_x,
+                            record.mouse_motion.relative_y);
+                    }
+                    break;
+                case event_type::mouse_button:
+                    if (_mouse_button_handler)
+                    {
+                        _mouse_button_handler(
+                            session_id,
+                            record.timestamp,
+                            record.window_id,
+                            record.mouse_button.button,
+                            record.mouse_button.state,
+                            record.mouse_button.double_click,
+                            record.mouse_button.x,
+                            record.mouse_button.y);
+                    }
+                    break;
+                case event_type::mouse_wheel:
+                    if (_mouse_wheel_handler)
+                    {
+                        _mouse_wheel_handler(
+                            session_id,
+                            record.timestamp,
+                            record.window_id,
+                            record.mouse_wheel.x,
+                            record.mouse_wheel.y,
+                            record.mouse_wheel.precise_x,
+                            record.mouse_wheel.precise_y);
+                    }
+                    break;
+                case event_type::window:
+                    if (_window_handler)
+                    {
+                        _window_handler(
+                            session_id,
+                            record.timestamp,
+                            record.window_id,
+                            record.window.type,
+                            record.window.arg1,
+                            record.window.arg2);
+                    }
+                    break;
                 }
             }
 
             std::unique_ptr<capnp::EzRpcServer> _rpc_server;
+            std::string _address;
             bool _active;
             kj::Own<kj::PromiseCrossThreadFulfillerPair<void>> _promise_fulfiller;
+            // a session number is the entry's slot + 1 in the low bits and the slot's generation above
+            // them, so a number still queued somewhere never resolves to a later session in its slot
+            static constexpr uint32_t session_slot_bits = 20;
+            static constexpr uint32_t session_slot_mask = (1u << session_slot_bits) - 1;
+            static constexpr uint32_t session_generation_mask = (1u << (32 - session_slot_bits)) - 1;
+
+            mutable std::mutex _sessions_mutex;
+            std::unordered_map<std::string, uint32_t> _session_numbers;
+            // indexed by slot, empty while the slot is free
+            std::vector<std::unique_ptr<session_entry>> _sessions;
+            std::vector<uint32_t> _generations;
+            std::vector<size_t> _free_slots;
+            const session_entry *_last_session = nullptr;
+            bool _tracking = false;
+            std::vector<event> _decoded;
+            std::unique_ptr<spsc_queue<event>> _events;
+            std::atomic<uint64_t> _dropped_events{0};
+            bool _datagrams;
+            kj::Own<kj::DatagramPort> _datagram_port;
+            kj::Own<kj::DatagramReceiver> _datagram_receiver;
+            kj::Promise<void> _receive_task = nullptr;
+            std::unordered_map<uint64_t, connection *> _channels;
+            std::mt19937_64 _token_generator{std::random_device()()};
+            std::atomic<uint64_t> _dropped_datagrams{0};
+            std::atomic<uint64_t> _recovered_datagrams{0};
+            // written by the thread running serve()
+            counter _received[event_type_count];
+            counter _bytes;
+            counter _handler_ns;
+            counter _sessions_opened;
+            counter _sessions_closed;
+            std::unique_ptr<recorder> _recorder;
+            std::unique_ptr<shm_server> _shm;
+            // declared last so the workers are joined before the handlers they call are destroyed
+            std::unique_ptr<worker_pool> _workers;
         };
     }
 
-    client::client(const std::string &host, uint16_t port)
+    client::client(const std::string &host, uint16_t port, io_mode mode, size_t queue_capacity) : client(make_address(host, port), mode, queue_capacity)
     {
-        _client = std::unique_ptr<internal::client, std::function<void(internal::client *)>>(
-            new internal::client(make_address(host, port)),
-            [](internal::client *client)
-            {
-                delete client;
-            });
+    }
+
+    client::client(const std::string &address, io_mode mode, size_t queue_capacity)
+    {
+        if (is_shm_address(address))
+        {
+            _shm_client = std::unique_ptr<internal::shm_client, std::function<void(internal::shm_client *)>>(
+                new internal::shm_client(address.substr(4)),
+                [](internal::shm_client *shm_client)
+                {
+                    delete shm_client;
+                });
+        }
+        else if (mode == io_mode::background_thread)
+        {
+            _client_thread = std::unique_ptr<internal::client_thread, std::function<void(internal::client_thread *)>>(
+                new internal::client_thread(address, queue_capacity),
+                [](internal::client_thread *client_thread)
+                {
+                    delete client_thread;
+                });
+        }
+        else
+        {
+            _client = std::unique_ptr<internal::client, std::function<void(internal::client *)>>(
+                new internal::client(address),
+                [](internal::client *client)
+                {
+                    delete client;
+                });
+        }
     }
 
     void client::connect(const uint8_t *buffer, size_t size)
     {
-        _client->connect(buffer, size);
+        if (_shm_client)
+        {
+            _shm_client->connect(buffer, size);
+            return;
+        }
+        invoke(
+            [&](internal::client &client)
+            {
+                client.connect(buffer, size);
+            });
     }
 
     void client::disconnect()
     {
-        _client->disconnect();
+        if (_shm_client)
+        {
+            _shm_client->disconnect();
+            return;
+        }
+        invoke(
+            [&](internal::client &client)
+            {
+                client.disconnect();
+            });
     }
 
     void client::send_keyboard(uint64_t timestamp, uint32_t window_id, input_state state, bool repeat, uint32_t key_code)
     {
-        _client->send_keyboard(timestamp, window_id, state, repeat, key_code);
+        event record;
+        record.type = event_type::keyboard;
+        record.timestamp = timestamp;
+        record.window_id = window_id;
+        record.keyboard.state = state;
+        record.keyboard.repeat = repeat;
+        record.keyboard.key_code = key_code;
+        send(record);
     }
 
     void client::send_mouse_motion(uint64_t timestamp, uint32_t window_id, const mouse_button_state_mask &state_mask, int32_t x, int32_t y, int32_t relative_x, int32_t relative_y)
     {
-        _client->send_mouse_motion(timestamp, window_id, state_mask, x, y, relative_x, relative_y);
+        event record;
+        record.type = event_type::mouse_motion;
+        record.timestamp = timestamp;
+        record.window_id = window_id;
+        record.mouse_motion.state_mask = state_mask;
+        record.mouse_motion.x = x;
+        record.mouse_motion.y = y;
+        record.mouse_motion.relative_x = relative_x;
+        record.mouse_motion.relative_y = relative_y;
+        send(record);
+    }
+
+    void client::send_mouse_motion(uint64_t timestamp, uint32_t window_id, uint8_t buttons, int32_t x, int32_t y, int32_t relative_x, int32_t relative_y)
+    {
+        send_mouse_motion(timestamp, window_id, button_state_mask(buttons), x, y, relative_x, relative_y);
     }
 
     void client::send_mouse_button(uint64_t timestamp, uint32_t window_id, mouse_button button, input_state state, bool double_click, int32_t x, int32_t y)
     {
-        _client->send_mouse_button(timestamp, window_id, button, state, double_click, x, y);
+        event record;
+        record.type = event_type::mouse_button;
+        record.timestamp = timestamp;
+        record.window_id = window_id;
+        record.mouse_button.button = button;
+        record.mouse_button.state = state;
+        record.mouse_button.double_click = double_click;
+        record.mouse_button.x = x;
+        record.mouse_button.y = y;
+        send(record);
     }
 
     void client::send_mouse_wheel(uint64_t timestamp, uint32_t window_id, int32_t x, int32_t y)
     {
-        _client->send_mouse_wheel(timestamp, window_id, x, y, static_cast<float>(x), static_cast<float>(y));
+        send_mouse_wheel(timestamp, window_id, x, y, static_cast<float>(x), static_cast<float>(y));
     }
 
     void client::send_mouse_wheel(uint64_t timestamp, uint32_t window_id, int32_t x, int32_t y, float precise_x, float precise_y)
     {
-        _client->send_mouse_wheel(timestamp, window_id, x, y, precise_x, precise_y);
+        event record;
+        record.type = event_type::mouse_wheel;
+        record.timestamp = timestamp;
+        record.window_id = window_id;
+        record.mouse_wheel.x = x;
+        record.mouse_wheel.y = y;
+        record.mouse_wheel.precise_x = precise_x;
+        record.mouse_wheel.precise_y = precise_y;
+        send(record);
     }
 
     void client::send_window(uint64_t timestamp, uint32_t window_id, window_event type, int32_t arg1, int32_t arg2)
     {
-        _client->send_window(timestamp, window_id, type, arg1, arg2);
+        event record;
+        record.type = event_type::window;
+        record.timestamp = timestamp;
+        record.window_id = window_id;
+        record.window.type = type;
+        record.window.arg1 = arg1;
+        record.window.arg2 = arg2;
+        send(record);
+    }
+
+    void client::begin_batch()
+    {
+        invoke(
+            [&](internal::client &client)
+            {
+                client.begin_batch();
+            });
+    }
+
+    void client::send_batch()
+    {
+        invoke(
+            [&](internal::client &client)
+            {
+                client.send_batch();
+            });
+    }
+
+    void client::set_send_mode(send_mode mode, size_t max_in_flight)
+    {
+        invoke(
+            [&](internal::client &client)
+            {
+                client.set_send_mode(mode, max_in_flight);
+            });
+    }
+
+    void client::set_flush_policy(const flush_policy &policy)
+    {
+        invoke(
+            [&](internal::client &client)
+            {
+                client.set_flush_policy(policy);
+            });
+    }
+
+    void client::flush()
+    {
+        if (_shm_client)
+        {
+            _shm_client->flush();
+            return;
+        }
+        invoke(
+            [&](internal::client &client)
+            {
+                client.flush();
+            });
+    }
+
+    void client::handle_error(const std::function<void(const std::string &)> &error_handler)
+    {
+        invoke(
+            [&](internal::client &client)
+            {
+                client._error_handler = error_handler;
+            });
+    }
+
+    void client::set_coalescing(bool enabled)
+    {
+        invoke(
+            [&](internal::client &client)
+            {
+                client.set_coalescing(enabled);
+            });
+    }
+
+    void client::set_udp(bool enabled, size_t parity_group)
+    {
+        invoke(
+            [&](internal::client &client)
+            {
+                client.set_udp(enabled, parity_group);
+            });
+    }
+
+    uint64_t client::coalesced_events() const
+    {
+        uint64_t result;
+        if (_shm_client)
+        {
+            result = 0;
+        }
+        else
+        {
+            result = _client_thread ? _client_thread->coalesced_events() : _client->coalesced_events();
+        }
+        return result;
+    }
+
+    lane_stats client::get_lane_stats(lane which) const
+    {
+        lane_stats result;
+        if (_client_thread)
+        {
+            result = _client_thread->get_lane_stats(which);
+        }
+        else
+        {
+            result.events = 0;
+            result.total_wait_ns = 0;
+            result.max_wait_ns = 0;
+        }
+        return result;
+    }
+
+    client_stats client::stats() const
+    {
+        client_stats result;
+        if (_shm_client)
+        {
+            result = client_stats();
+        }
+        else
+        {
+            result = _client_thread ? _client_thread->stats() : _client->stats();
+        }
+        return result;
+    }
+
+    void client::send(const event &record)
+    {
+        if (_shm_client)
+        {
+            _shm_client->send(record);
+        }
+        else if (_client_thread)
+        {
+            _client_thread->push(record);
+        }
+        else
+        {
+            _client->send(record);
+        }
+    }
+
+    // the shared-memory transport writes every record straight into the ring, so batching, send
+    // modes and coalescing have nothing to act on, and its errors are thrown by the call itself
+    void client::invoke(const std::function<void(internal::client &)> &function)
+    {
+        if (_shm_client)
+        {
+            return;
+        }
+        if (_client_thread)
+        {
+            _client_thread->execute(function);
+        }
+        else
+        {
+            function(*_client);
+        }
+    }
+
+    server::server(const std::string &host, uint16_t port) : server(make_address(host, port))
+    {
     }
 
-    server::server(const std::string &host, uint16_t port)
+    server::server(const std::string &address)
     {
         _server = std::unique_ptr<internal::server, std::function<void(internal::server *)>>(
-            new internal::server(make_address(host, port)),
+            new internal::server(address),
             [](internal::server *server)
             {
                 delete server;
@@ -632,6 +4633,76 @@ namespace netput
         _server->shutdown();
     }
 
+    void server::set_workers(size_t count)
+    {
+        _server->set_workers(count);
+    }
+
+    std::vector<worker_stats> server::get_worker_stats() const
+    {
+        return _server->get_worker_stats();
+    }
+
+    void server::set_polling(size_t capacity)
+    {
+        _server->set_polling(capacity);
+    }
+
+    size_t server::poll(event *events, size_t max)
+    {
+        return _server->poll(events, max);
+    }
+
+    bool server::try_pop(event &value)
+    {
+        return _server->poll(&value, 1) == 1;
+    }
+
+    uint64_t server::dropped_events() const
+    {
+        return _server->dropped_events();
+    }
+
+    void server::set_udp(bool enabled)
+    {
+        _server->set_udp(enabled);
+    }
+
+    uint64_t server::dropped_datagrams() const
+    {
+        return _server->dropped_datagrams();
+    }
+
+    uint64_t server::recovered_datagrams() const
+    {
+        return _server->recovered_datagrams();
+    }
+
+    server_stats server::stats() const
+    {
+        return _server->stats();
+    }
+
+    void server::set_recording(const std::string &path)
+    {
+        _server->set_recording(path);
+    }
+
+    std::string server::session_id(uint32_t session) const
+    {
+        return _server->session_id(session);
+    }
+
+    void server::set_input_tracking(bool enabled)
+    {
+        _server->set_input_tracking(enabled);
+    }
+
+    bool server::get_input_state(const std::string &session_id, input_snapshot &state) const
+    {
+        return _server->get_input_state(session_id, state);
+    }
+
     void server::handle_connect(const std::function<std::pair<bool, std::string>(const uint8_t *, size_t)> &connect_handler)
     {
         _server->_connect_handler = connect_handler;
@@ -666,4 +4737,29 @@ namespace netput
     {
         _server->_window_handler = window_handler;
     }
+
+    void server::handle_events(const std::function<void(const event *, size_t)> &events_handler)
+    {
+        _server->_events_handler = events_handler;
+    }
+
+    void server::handle_error(const std::function<void(const std::string &)> &error_handler)
+    {
+        _server->_error_handler = error_handler;
+    }
+
+    replay::replay(const std::string &path)
+    {
+        _replay = std::unique_ptr<internal::replay, std::function<void(internal::replay *)>>(
+            new internal::replay(path),
+            [](internal::replay *replay)
+            {
+                delete replay;
+            });
+    }
+
+    replay_stats replay::play(const std::string &address, const replay_options &options)
+    {
+        return _replay->play(address, options);
+    }
 }
\ No newline at end of file
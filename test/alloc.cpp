@@ -0,0 +1,249 @@
+// white-box test of the server receive path, built from the library source so it can reach
+// netput::internal and feed decoded messages straight into the server without any rpc traffic
+#include "internal.hpp"
+
+#include <cstdlib>
+#include <new>
+
+static std::atomic<uint64_t> allocations(0);
+
+void *operator new(size_t size)
+{
+    void *pointer;
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    pointer = std::malloc((size > 0) ? size : 1);
+    if (pointer == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return pointer;
+}
+
+void operator delete(void *pointer) noexcept
+{
+    std::free(pointer);
+}
+
+void operator delete(void *pointer, size_t) noexcept
+{
+    std::free(pointer);
+}
+
+namespace alloc
+{
+    const std::string address = "127.0.0.1:12360";
+    const std::string session_id = "allocation-session-id";
+    const size_t warmup_rounds = 16;
+    const size_t rounds = 256;
+    const size_t batch_size = 64;
+
+    static std::atomic<uint64_t> handled(0);
+
+    static netput::event make_event(netput::event_type type, size_t index)
+    {
+        netput::event record;
+        record.type = type;
+        record.session = 0;
+        record.timestamp = index;
+        record.window_id = 1;
+        switch (type)
+        {
+        case netput::event_type::keyboard:
+            record.keyboard.state = netput::input_state::pressed;
+            record.keyboard.repeat = false;
+            record.keyboard.key_code = static_cast<uint32_t>(index);
+            break;
+        case netput::event_type::mouse_motion:
+            record.mouse_motion.state_mask = internal_test::released;
+            record.mouse_motion.x = static_cast<int32_t>(index);
+            record.mouse_motion.y = static_cast<int32_t>(index);
+            record.mouse_motion.relative_x = 1;
+            record.mouse_motion.relative_y = 1;
+            break;
+        case netput::event_type::mouse_button:
+            record.mouse_button.button = netput::mouse_button::left;
+            record.mouse_button.state = netput::input_state::pressed;
+            record.mouse_button.double_click = false;
+            record.mouse_button.x = 0;
+            record.mouse_button.y = 0;
+            break;
+        case netput::event_type::mouse_wheel:
+            record.mouse_wheel.x = 0;
+            record.mouse_wheel.y = 1;
+            record.mouse_wheel.precise_x = 0.0f;
+            record.mouse_wheel.precise_y = 1.0f;
+            break;
+        case netput::event_type::window:
+            record.window.type = netput::window_event::focus_lost;
+            record.window.arg1 = 0;
+            record.window.arg2 = 0;
+            break;
+        }
+        return record;
+    }
+
+    // one message holding a batch with every event type, built before any counting starts
+    class messages
+    {
+    public:
+        messages()
+        {
+            const netput::event_type types[] = {
+                netput::event_type::keyboard,
+                netput::event_type::mouse_motion,
+                netput::event_type::mouse_button,
+                netput::event_type::mouse_wheel,
+                netput::event_type::window,
+            };
+            netput::rpc::EventBatch::Builder batch = _message.initRoot<netput::rpc::EventBatch>();
+            batch.setSessionId(session_id);
+            capnp::List<netput::rpc::Event>::Builder events = batch.initEvents(batch_size);
+            for (size_t index = 0; index < batch_size; index++)
+            {
+                netput::rpc::Event::Builder event = events[index];
+                netput::rpc::Event::Info::Builder info = event.initInfo();
+                event.setSessionId(session_id);
+                netput::internal::build_event_info(info, make_event(types[index % 5], index));
+            }
+        }
+
+        netput::rpc::EventBatch::Reader batch()
+        {
+            return _message.getRoot<netput::rpc::EventBatch>().asReader();
+        }
+
+    private:
+        capnp::MallocMessageBuilder _message;
+    };
+
+    static void handle_all(netput::internal::server &server)
+    {
+        server._keyboard_handler = [](const std::string &, uint64_t, uint32_t, netput::input_state, bool, uint32_t)
+        {
+            handled.fetch_add(1, std::memory_order_relaxed);
+        };
+        server._mouse_motion_handler = [](const std::string &, uint64_t, uint32_t, const netput::mouse_button_state_mask &, int32_t, int32_t, int32_t, int32_t)
+        {
+            handled.fetch_add(1, std::memory_order_relaxed);
+        };
+        server._mouse_button_handler = [](const std::string &, uint64_t, uint32_t, netput::mouse_button, netput::input_state, bool, int32_t, int32_t)
+        {
+            handled.fetch_add(1, std::memory_order_relaxed);
+        };
+        server._mouse_wheel_handler = [](const std::string &, uint64_t, uint32_t, int32_t, int32_t, float, float)
+        {
+            handled.fetch_add(1, std::memory_order_relaxed);
+        };
+        server._window_handler = [](const std::string &, uint64_t, uint32_t, netput::window_event, int32_t, int32_t)
+        {
+            handled.fetch_add(1, std::memory_order_relaxed);
+        };
+    }
+
+    static void handle_events(netput::internal::server &server)
+    {
+        server._keyboard_handler = nullptr;
+        server._mouse_motion_handler = nullptr;
+        server._mouse_button_handler = nullptr;
+        server._mouse_wheel_handler = nullptr;
+        server._window_handler = nullptr;
+        server._events_handler = [](const netput::event *, size_t count)
+        {
+            handled.fetch_add(count, std::memory_order_relaxed);
+        };
+    }
+
+    // pushes every event of the batch one by one and as one batch, through the session capability when
+    // there is one and the legacy methods otherwise, then drains whatever the path needs drained before
+    // the next round
+    static void push_round(netput::internal::server &server, netput::internal::session *channel, netput::rpc::EventBatch::Reader batch, netput::event *polled)
+    {
+        const uint64_t expected = handled.load(std::memory_order_relaxed) + 2 * batch_size;
+        for (const netput::rpc::Event::Reader event : batch.getEvents())
+        {
+            if (channel != nullptr)
+            {
+                channel->receive(event.getInfo());
+            }
+            else
+            {
+                server.handle_push(event);
+            }
+        }
+        if (channel != nullptr)
+        {
+            channel->receive(batch.getEvents());
+        }
+        else
+        {
+            server.handle_push_batch(batch);
+        }
+        if (polled != nullptr)
+        {
+            handled.fetch_add(server.poll(polled, 2 * batch_size), std::memory_order_relaxed);
+        }
+        while (handled.load(std::memory_order_relaxed) < expected)
+        {
+            std::this_thread::yield();
+        }
+    }
+
+    // allocations per event in steady state, must be zero
+    static double measure(const std::string &name, netput::internal::server &server, netput::internal::session *channel, netput::rpc::EventBatch::Reader batch, netput::event *polled)
+    {
+        uint64_t before;
+        uint64_t after;
+        double result;
+
+        for (size_t round = 0; round < warmup_rounds; round++)
+        {
+            push_round(server, channel, batch, polled);
+        }
+        before = allocations.load(std::memory_order_relaxed);
+        for (size_t round = 0; round < rounds; round++)
+        {
+            push_round(server, channel, batch, polled);
+        }
+        after = allocations.load(std::memory_order_relaxed);
+        result = static_cast<double>(after - before) / static_cast<double>(rounds * 2 * batch_size);
+        std::cout << name << ": " << (after - before) << " allocations, " << result << " per event" << std::endl;
+        if (after != before)
+        {
+            throw std::runtime_error(name + ": receive path allocated");
+        }
+        return result;
+    }
+
+    // every dispatch mode once through the legacy push methods and once through the session
+    // capability a connect hands out
+    static void receive_path()
+    {
+        messages batches;
+        netput::internal::server server(address);
+        std::vector<netput::event> polled(2 * batch_size);
+        kj::Own<netput::internal::session> channel = server.open_session(session_id, 0, 0);
+        handle_all(server);
+
+        measure("inline", server, nullptr, batches.batch(), nullptr);
+        measure("session inline", server, channel.get(), batches.batch(), nullptr);
+
+        server.set_workers(2);
+        measure("workers", server, nullptr, batches.batch(), nullptr);
+        measure("session workers", server, channel.get(), batches.batch(), nullptr);
+        server.set_workers(0);
+
+        handle_events(server);
+        measure("events", server, nullptr, batches.batch(), nullptr);
+        measure("session events", server, channel.get(), batches.batch(), nullptr);
+
+        server.set_polling(4 * batch_size);
+        measure("poll", server, nullptr, batches.batch(), polled.data());
+        measure("session poll", server, channel.get(), batches.batch(), polled.data());
+        server.set_polling(0);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    return internal_test::run({alloc::receive_path});
+}
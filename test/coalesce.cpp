@@ -0,0 +1,120 @@
+// white-box test of mouse-motion coalescing: runs of queued records go through
+// coalesce_mouse_motion and have to come out merged exactly where the rules allow it
+#include "internal.hpp"
+
+namespace coalesce
+{
+    using internal_test::expect;
+    using internal_test::released;
+
+    const netput::mouse_button_state_mask left_held = {netput::input_state::pressed, netput::input_state::released, netput::input_state::released, netput::input_state::released, netput::input_state::released};
+
+    static netput::event make_motion(uint64_t timestamp, uint32_t window_id, const netput::mouse_button_state_mask &state_mask, int32_t relative_x, int32_t relative_y)
+    {
+        netput::event record;
+        record.type = netput::event_type::mouse_motion;
+        record.session = 0;
+        record.timestamp = timestamp;
+        record.window_id = window_id;
+        record.mouse_motion.state_mask = state_mask;
+        record.mouse_motion.x = static_cast<int32_t>(timestamp * 10);
+        record.mouse_motion.y = static_cast<int32_t>(timestamp * 20);
+        record.mouse_motion.relative_x = relative_x;
+        record.mouse_motion.relative_y = relative_y;
+        return record;
+    }
+
+    static netput::event make_button(uint64_t timestamp, uint32_t window_id)
+    {
+        netput::event record;
+        record.type = netput::event_type::mouse_button;
+        record.session = 0;
+        record.timestamp = timestamp;
+        record.window_id = window_id;
+        record.mouse_button.button = netput::mouse_button::left;
+        record.mouse_button.state = netput::input_state::pressed;
+        record.mouse_button.double_click = false;
+        record.mouse_button.x = 0;
+        record.mouse_button.y = 0;
+        return record;
+    }
+
+    static void expect_motion(const std::string &name, const netput::event &record, uint64_t timestamp, uint32_t window_id, int32_t relative_x, int32_t relative_y)
+    {
+        expect(record.type == netput::event_type::mouse_motion, name, "expected a motion record");
+        expect(record.timestamp == timestamp, name, "wrong timestamp " + std::to_string(record.timestamp));
+        expect(record.window_id == window_id, name, "wrong window " + std::to_string(record.window_id));
+        expect(record.mouse_motion.x == static_cast<int32_t>(timestamp * 10) && record.mouse_motion.y == static_cast<int32_t>(timestamp * 20), name, "position is not the newest sample's");
+        expect(record.mouse_motion.relative_x == relative_x && record.mouse_motion.relative_y == relative_y, name, "wrong summed deltas");
+    }
+
+    static size_t run(std::vector<netput::event> &records)
+    {
+        return netput::internal::coalesce_mouse_motion(records);
+    }
+
+    static void merges_a_run()
+    {
+        std::vector<netput::event> records = {make_motion(1, 1, released, 1, 2), make_motion(2, 1, released, 3, 4), make_motion(3, 1, released, -1, 1)};
+        expect(run(records) == 2, "merges_a_run", "expected two merged records");
+        expect(records.size() == 1, "merges_a_run", "expected one record left");
+        expect_motion("merges_a_run", records[0], 3, 1, 3, 7);
+    }
+
+    static void keeps_different_masks()
+    {
+        std::vector<netput::event> records = {make_motion(1, 1, released, 1, 1), make_motion(2, 1, left_held, 1, 1), make_motion(3, 1, left_held, 1, 1)};
+        expect(run(records) == 1, "keeps_different_masks", "expected one merged record");
+        expect(records.size() == 2, "keeps_different_masks", "expected two records left");
+        expect_motion("keeps_different_masks", records[0], 1, 1, 1, 1);
+        expect_motion("keeps_different_masks", records[1], 3, 1, 2, 2);
+    }
+
+    static void stops_at_other_events()
+    {
+        std::vector<netput::event> records = {make_motion(1, 1, released, 1, 1), make_button(2, 1), make_motion(3, 1, released, 1, 1), make_motion(4, 1, released, 1, 1)};
+        expect(run(records) == 1, "stops_at_other_events", "expected one merged record");
+        expect(records.size() == 3, "stops_at_other_events", "expected three records left");
+        expect_motion("stops_at_other_events", records[0], 1, 1, 1, 1);
+        expect(records[1].type == netput::event_type::mouse_button && records[1].timestamp == 2, "stops_at_other_events", "button moved");
+        expect_motion("stops_at_other_events", records[2], 4, 1, 2, 2);
+    }
+
+    static void keeps_windows_apart()
+    {
+        std::vector<netput::event> records = {make_motion(1, 1, released, 1, 0), make_motion(2, 2, released, 0, 1), make_motion(3, 1, released, 1, 0), make_motion(4, 2, released, 0, 1)};
+        expect(run(records) == 2, "keeps_windows_apart", "expected two merged records");
+        expect(records.size() == 2, "keeps_windows_apart", "expected one record per window");
+        expect_motion("keeps_windows_apart", records[0], 3, 1, 2, 0);
+        expect_motion("keeps_windows_apart", records[1], 4, 2, 0, 2);
+    }
+
+    static void keeps_deltas_exact()
+    {
+        std::vector<netput::event> records = {make_motion(1, 1, released, INT32_MAX, 0), make_motion(2, 1, released, 1, 0), make_motion(3, 1, released, 1, INT32_MIN), make_motion(4, 1, released, 0, -1)};
+        expect(run(records) == 1, "keeps_deltas_exact", "expected one merged record");
+        expect(records.size() == 3, "keeps_deltas_exact", "expected three records left");
+        expect_motion("keeps_deltas_exact", records[0], 1, 1, INT32_MAX, 0);
+        // the third sample merges into the second, the latest motion of its window
+        expect_motion("keeps_deltas_exact", records[1], 3, 1, 2, INT32_MIN);
+        expect_motion("keeps_deltas_exact", records[2], 4, 1, 0, -1);
+    }
+
+    static void leaves_the_rest()
+    {
+        std::vector<netput::event> records;
+        expect(run(records) == 0 && records.empty(), "leaves_the_rest", "empty input changed");
+        records = {make_button(1, 1), make_button(2, 1)};
+        expect(run(records) == 0 && records.size() == 2, "leaves_the_rest", "non-motion records merged");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    return internal_test::run({coalesce::merges_a_run,
+                               coalesce::keeps_different_masks,
+                               coalesce::stops_at_other_events,
+                               coalesce::keeps_windows_apart,
+                               coalesce::keeps_deltas_exact,
+                               coalesce::leaves_the_rest});
+}
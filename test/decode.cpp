@@ -0,0 +1,102 @@
+// white-box test of the motion wire format: older clients send the nested stateMask struct, newer
+// ones the buttons bit field, and read_event_info has to turn both into the same state mask
+#include "internal.hpp"
+
+namespace decode
+{
+    using internal_test::expect;
+
+    static netput::event read(capnp::MallocMessageBuilder &message, const std::string &name)
+    {
+        netput::event record;
+        const netput::rpc::Event::Reader reader = message.getRoot<netput::rpc::Event>().asReader();
+        expect(netput::internal::read_event_info(reader.getInfo(), record), name, "event not readable");
+        expect(record.type == netput::event_type::mouse_motion, name, "expected a motion record");
+        return record;
+    }
+
+    static netput::rpc::MouseMotionEvent::Builder init_motion(capnp::MallocMessageBuilder &message)
+    {
+        netput::rpc::MouseMotionEvent::Builder motion = message.initRoot<netput::rpc::Event>().initInfo().initMouseMotion();
+        motion.setTimestamp(7);
+        motion.setWindowId(3);
+        motion.setX(10);
+        motion.setY(20);
+        motion.setRelativeX(-1);
+        motion.setRelativeY(2);
+        return motion;
+    }
+
+    static void old_state_mask()
+    {
+        capnp::MallocMessageBuilder message;
+        netput::rpc::MouseMotionEvent::Builder motion = init_motion(message);
+        netput::rpc::MouseMotionEvent::MouseStateMask::Builder state_mask = motion.initStateMask();
+        state_mask.setLeft(netput::rpc::InputState::PRESSED);
+        state_mask.setX2(netput::rpc::InputState::PRESSED);
+        const netput::event record = read(message, "old_state_mask");
+        expect(record.mouse_motion.state_mask.left == netput::input_state::pressed &&
+                   record.mouse_motion.state_mask.middle == netput::input_state::released &&
+                   record.mouse_motion.state_mask.right == netput::input_state::released &&
+                   record.mouse_motion.state_mask.x1 == netput::input_state::released &&
+                   record.mouse_motion.state_mask.x2 == netput::input_state::pressed,
+               "old_state_mask", "wrong mask");
+        expect(record.timestamp == 7 && record.window_id == 3 && record.mouse_motion.x == 10 && record.mouse_motion.y == 20 &&
+                   record.mouse_motion.relative_x == -1 && record.mouse_motion.relative_y == 2,
+               "old_state_mask", "wrong motion fields");
+    }
+
+    static void state_mask_wins()
+    {
+        capnp::MallocMessageBuilder message;
+        netput::rpc::MouseMotionEvent::Builder motion = init_motion(message);
+        motion.initStateMask();
+        motion.setButtons(0x1f);
+        const netput::event record = read(message, "state_mask_wins");
+        expect(netput::button_bits(record.mouse_motion.state_mask) == 0, "state_mask_wins", "buttons read although stateMask is present");
+    }
+
+    static void new_buttons()
+    {
+        capnp::MallocMessageBuilder message;
+        netput::rpc::MouseMotionEvent::Builder motion = init_motion(message);
+        motion.setButtons(1 << netput::mouse_button::right);
+        const netput::event record = read(message, "new_buttons");
+        expect(record.mouse_motion.state_mask.right == netput::input_state::pressed &&
+                   netput::button_bits(record.mouse_motion.state_mask) == (1 << netput::mouse_button::right),
+               "new_buttons", "wrong mask");
+    }
+
+    // what this build sends has no stateMask and reads back to the mask it was built from
+    static void round_trips()
+    {
+        netput::event sent;
+        netput::event received;
+        sent.type = netput::event_type::mouse_motion;
+        sent.session = 0;
+        sent.timestamp = 1;
+        sent.window_id = 1;
+        sent.mouse_motion.x = 0;
+        sent.mouse_motion.y = 0;
+        sent.mouse_motion.relative_x = 0;
+        sent.mouse_motion.relative_y = 0;
+        for (uint8_t bits = 0; bits < 32; bits++)
+        {
+            capnp::MallocMessageBuilder message;
+            netput::rpc::Event::Info::Builder info = message.initRoot<netput::rpc::Event>().initInfo();
+            sent.mouse_motion.state_mask = netput::button_state_mask(bits);
+            netput::internal::build_event_info(info, sent);
+            expect(!message.getRoot<netput::rpc::Event>().getInfo().getMouseMotion().hasStateMask(), "round_trips", "stateMask sent");
+            received = read(message, "round_trips");
+            expect(netput::button_bits(received.mouse_motion.state_mask) == bits, "round_trips", "mask " + std::to_string(bits) + " changed");
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    return internal_test::run({decode::old_state_mask,
+                               decode::state_mask_wins,
+                               decode::new_buttons,
+                               decode::round_trips});
+}
@@ -0,0 +1,181 @@
+// white-box loss simulation of the udp side channel: motion datagrams from the client encoder go
+// through a lossy link into the server decoder, which has to rebuild every datagram that is the only
+// loss of its parity group and hand everything on in sequence order
+#include "internal.hpp"
+
+#include <iomanip>
+
+namespace fec
+{
+    const size_t events = 100000;
+    const size_t group_size = 8;
+    // 1 kHz motion, the link itself adds no delay so any latency is the decoder waiting for parity
+    const uint64_t interval_us = 1000;
+    const double loss_rates[] = {0.01, 0.05, 0.10};
+
+    struct packet
+    {
+        std::vector<uint64_t> words;
+        uint64_t sent_us;
+        // 0 for a parity datagram
+        uint64_t sequence;
+    };
+
+    static netput::event make_motion(size_t index)
+    {
+        netput::event record;
+        record.type = netput::event_type::mouse_motion;
+        record.session = 0;
+        record.timestamp = index;
+        record.window_id = 1;
+        record.mouse_motion.state_mask = internal_test::released;
+        record.mouse_motion.x = static_cast<int32_t>(index);
+        record.mouse_motion.y = static_cast<int32_t>(index % 1080);
+        record.mouse_motion.relative_x = 1;
+        record.mouse_motion.relative_y = 0;
+        return record;
+    }
+
+    static std::vector<packet> encode()
+    {
+        std::vector<packet> packets;
+        netput::internal::datagram_encoder encoder;
+
+        encoder.reset(1, group_size);
+        for (size_t index = 0; index < events; index++)
+        {
+            const uint64_t sequence = encoder.sequence() + 1;
+            size_t sends = 0;
+            encoder.encode(
+                make_motion(index),
+                0,
+                [&](const kj::ArrayPtr<const kj::byte> &bytes)
+                {
+                    packet sent;
+                    sent.words.resize(bytes.size() / sizeof(capnp::word));
+                    std::memcpy(sent.words.data(), bytes.begin(), bytes.size());
+                    sent.sent_us = index * interval_us;
+                    sent.sequence = (sends++ == 0) ? sequence : 0;
+                    packets.push_back(std::move(sent));
+                });
+        }
+        return packets;
+    }
+
+    static void simulate(const std::vector<packet> &packets, double loss_rate)
+    {
+        std::mt19937_64 generator(42);
+        std::bernoulli_distribution lose(loss_rate);
+        netput::internal::datagram_decoder decoder;
+        std::vector<bool> lost(packets.size());
+        uint64_t now_us;
+        uint64_t last_delivered;
+        uint64_t delivered;
+        uint64_t lost_data;
+        uint64_t expected;
+        uint64_t added_total_us;
+        uint64_t added_max_us;
+        uint64_t waited;
+        size_t group_lost;
+
+        for (size_t index = 0; index < packets.size(); index++)
+        {
+            lost[index] = lose(generator);
+        }
+
+        // a data loss is rebuilt exactly when it is the only loss among its group and the parity
+        lost_data = 0;
+        expected = 0;
+        group_lost = 0;
+        for (size_t index = 0; index < packets.size(); index++)
+        {
+            if (lost[index])
+            {
+                group_lost++;
+                if (packets[index].sequence != 0)
+                {
+                    lost_data++;
+                }
+            }
+            if (packets[index].sequence == 0)
+            {
+                if (group_lost == 1 && !lost[index])
+                {
+                    expected++;
+                }
+                group_lost = 0;
+            }
+        }
+
+        decoder.reset(group_size);
+        now_us = 0;
+        last_delivered = 0;
+        delivered = 0;
+        added_total_us = 0;
+        added_max_us = 0;
+        waited = 0;
+        const auto accept = [&](uint64_t sequence, uint64_t, const netput::event &record)
+        {
+            const uint64_t added_us = now_us - (sequence - 1) * interval_us;
+            if (sequence <= last_delivered)
+            {
+                throw std::runtime_error("datagram handed on out of order");
+            }
+            if (record.mouse_motion.x != static_cast<int32_t>(sequence - 1) || record.timestamp != sequence - 1)
+            {
+                throw std::runtime_error("datagram handed on with the wrong contents");
+            }
+            last_delivered = sequence;
+            delivered++;
+            added_total_us += added_us;
+            added_max_us = std::max(added_max_us, added_us);
+            waited += (added_us > 0) ? 1 : 0;
+        };
+        for (size_t index = 0; index < packets.size(); index++)
+        {
+            if (!lost[index])
+            {
+                const kj::ArrayPtr<const capnp::word> words(reinterpret_cast<const capnp::word *>(packets[index].words.data()), packets[index].words.size());
+                capnp::FlatArrayMessageReader message(words);
+                now_us = packets[index].sent_us;
+                decoder.receive(words.asBytes(), message.getRoot<netput::rpc::Datagram>(), accept);
+            }
+        }
+
+        std::cout << std::fixed << std::setprecision(3)
+                  << "{\"loss\":" << loss_rate
+                  << ",\"group_size\":" << group_size
+                  << ",\"datagrams\":" << events
+                  << ",\"lost\":" << lost_data
+                  << ",\"recovered\":" << decoder.recovered()
+                  << ",\"reconstruction_rate\":" << ((lost_data > 0) ? static_cast<double>(decoder.recovered()) / lost_data : 1.0)
+                  << ",\"delivered\":" << delivered
+                  << ",\"delayed\":" << waited
+                  << ",\"mean_added_us\":" << static_cast<double>(added_total_us) / delivered
+                  << ",\"max_added_us\":" << added_max_us
+                  << "}" << std::endl;
+
+        if (decoder.recovered() != expected)
+        {
+            throw std::runtime_error("a single loss in a parity group was not rebuilt");
+        }
+        if (delivered != events - lost_data + expected)
+        {
+            throw std::runtime_error("datagrams went missing in the decoder");
+        }
+    }
+
+    static void lossy_links()
+    {
+        const std::vector<packet> packets = encode();
+        for (double loss_rate : loss_rates)
+        {
+            simulate(packets, loss_rate);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    return internal_test::run({fec::lossy_links});
+}
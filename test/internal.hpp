@@ -0,0 +1,43 @@
+#ifndef INTERNAL_HPP
+#define INTERNAL_HPP
+
+// white-box tests build the library source into the test itself so they can reach
+// netput::internal, this header is the one place that does so
+#include "../src/netput.cpp"
+
+#include <iostream>
+
+namespace internal_test
+{
+    const netput::mouse_button_state_mask released = {netput::input_state::released, netput::input_state::released, netput::input_state::released, netput::input_state::released, netput::input_state::released};
+
+    inline void expect(bool condition, const std::string &name, const std::string &what)
+    {
+        if (!condition)
+        {
+            throw std::runtime_error(name + ": " + what);
+        }
+    }
+
+    // runs the cases in order, the first one that throws fails the test
+    inline int run(const std::vector<std::function<void()>> &cases)
+    {
+        int result;
+        try
+        {
+            result = 0;
+            for (const std::function<void()> &test_case : cases)
+            {
+                test_case();
+            }
+        }
+        catch (const std::exception &error)
+        {
+            result = 1;
+            std::cerr << error.what() << std::endl;
+        }
+        return result;
+    }
+}
+
+#endif
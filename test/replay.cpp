@@ -0,0 +1,308 @@
+// record and replay round trip: two sessions send every event type to a recording server, then
+// the recording is played against a second server, which has to receive the same events for the
+// same sessions in the same order
+#include "internal.hpp"
+
+#include <arpa/inet.h>
+#include <cstdio>
+#include <netinet/in.h>
+
+namespace replay
+{
+    const std::string recording = "netput_replay_test.log";
+    const uint16_t record_port = 12361;
+    const uint16_t replay_port = 12362;
+    const std::string session_ids[] = {"alpha", "beta"};
+    const size_t events_per_session = 200;
+
+    struct received
+    {
+        std::string session_id;
+        netput::event record;
+    };
+
+    static std::string address(uint16_t port)
+    {
+        return "127.0.0.1:" + std::to_string(port);
+    }
+
+    // the server listens once its event loop runs, a plain tcp connect tells without opening a session
+    static void wait_listening(uint16_t port)
+    {
+        struct sockaddr_in peer;
+        int probe;
+        bool listening;
+        std::memset(&peer, 0, sizeof(peer));
+        peer.sin_family = AF_INET;
+        peer.sin_port = htons(port);
+        peer.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        do
+        {
+            probe = socket(AF_INET, SOCK_STREAM, 0);
+            listening = probe >= 0 && connect(probe, reinterpret_cast<const struct sockaddr *>(&peer), sizeof(peer)) == 0;
+            if (probe >= 0)
+            {
+                close(probe);
+            }
+            if (!listening)
+            {
+                std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            }
+        } while (!listening && std::chrono::steady_clock::now() < deadline);
+        if (!listening)
+        {
+            throw std::runtime_error("server on port " + std::to_string(port) + " did not start");
+        }
+    }
+
+    // serves on its own thread, the event loop belongs to the thread that creates the server
+    class running_server
+    {
+    public:
+        running_server(uint16_t port, const std::string &path)
+        {
+            std::promise<void> ready;
+            _thread = std::thread(
+                [this, port, path, &ready]()
+                {
+                    _server = std::make_unique<netput::server>(address(port));
+                    _server->set_recording(path);
+                    _server->handle_connect(
+                        [](const uint8_t *buffer, size_t size)
+                        {
+                            return std::make_pair(true, std::string(reinterpret_cast<const char *>(buffer), size));
+                        });
+                    _server->handle_disconnect(
+                        [](const std::string &)
+                        {
+                            return true;
+                        });
+                    _server->handle_events(
+                        [this](const netput::event *events, size_t count)
+                        {
+                            std::lock_guard<std::mutex> lock(_mutex);
+                            for (size_t index = 0; index < count; index++)
+                            {
+                                _received.push_back({_server->session_id(events[index].session), events[index]});
+                            }
+                        });
+                    ready.set_value();
+                    _server->serve();
+                });
+            ready.get_future().wait();
+            wait_listening(port);
+        }
+
+        // the recording is complete once the server is gone
+        std::vector<received> stop()
+        {
+            _server->shutdown();
+            _thread.join();
+            _server.reset();
+            std::lock_guard<std::mutex> lock(_mutex);
+            return _received;
+        }
+
+    private:
+        std::unique_ptr<netput::server> _server;
+        std::thread _thread;
+        std::mutex _mutex;
+        std::vector<received> _received;
+    };
+
+    static netput::event make_event(size_t session, size_t index)
+    {
+        netput::event record;
+        record.type = static_cast<netput::event_type>(index % netput::event_type_count);
+        record.session = 0;
+        record.timestamp = 1000 + index;
+        record.window_id = static_cast<uint32_t>(session + 1);
+        switch (record.type)
+        {
+        case netput::event_type::keyboard:
+            record.keyboard.state = (index % 2 == 0) ? netput::input_state::pressed : netput::input_state::released;
+            record.keyboard.repeat = index % 3 == 0;
+            record.keyboard.key_code = static_cast<uint32_t>(index);
+            break;
+        case netput::event_type::mouse_motion:
+            record.mouse_motion.state_mask = netput::button_state_mask(static_cast<uint8_t>(index % 32));
+            record.mouse_motion.x = static_cast<int32_t>(index);
+            record.mouse_motion.y = -static_cast<int32_t>(index);
+            record.mouse_motion.relative_x = 1;
+            record.mouse_motion.relative_y = -1;
+            break;
+        case netput::event_type::mouse_button:
+            record.mouse_button.button = static_cast<netput::mouse_button>(index % 5);
+            record.mouse_button.state = netput::input_state::pressed;
+            record.mouse_button.double_click = index % 4 == 0;
+            record.mouse_button.x = static_cast<int32_t>(index);
+            record.mouse_button.y = static_cast<int32_t>(session);
+            break;
+        case netput::event_type::mouse_wheel:
+            record.mouse_wheel.x = 0;
+            record.mouse_wheel.y = 1;
+            record.mouse_wheel.precise_x = 0.25f;
+            record.mouse_wheel.precise_y = 1.5f;
+            break;
+        case netput::event_type::window:
+            record.window.type = static_cast<netput::window_event>(index % 12);
+            record.window.arg1 = static_cast<int32_t>(index);
+            record.window.arg2 = static_cast<int32_t>(session);
+            break;
+        }
+        return record;
+    }
+
+    static bool same_event(const netput::event &lhs, const netput::event &rhs)
+    {
+        bool result;
+        result = lhs.type == rhs.type && lhs.timestamp == rhs.timestamp && lhs.window_id == rhs.window_id;
+        if (result)
+        {
+            switch (lhs.type)
+            {
+            case netput::event_type::keyboard:
+                result = lhs.keyboard.state == rhs.keyboard.state && lhs.keyboard.repeat == rhs.keyboard.repeat && lhs.keyboard.key_code == rhs.keyboard.key_code;
+                break;
+            case netput::event_type::mouse_motion:
+                result = netput::button_bits(lhs.mouse_motion.state_mask) == netput::button_bits(rhs.mouse_motion.state_mask) &&
+                         lhs.mouse_motion.x == rhs.mouse_motion.x && lhs.mouse_motion.y == rhs.mouse_motion.y &&
+                         lhs.mouse_motion.relative_x == rhs.mouse_motion.relative_x && lhs.mouse_motion.relative_y == rhs.mouse_motion.relative_y;
+                break;
+            case netput::event_type::mouse_button:
+                result = lhs.mouse_button.button == rhs.mouse_button.button && lhs.mouse_button.state == rhs.mouse_button.state &&
+                         lhs.mouse_button.double_click == rhs.mouse_button.double_click &&
+                         lhs.mouse_button.x == rhs.mouse_button.x && lhs.mouse_button.y == rhs.mouse_button.y;
+                break;
+            case netput::event_type::mouse_wheel:
+                result = lhs.mouse_wheel.x == rhs.mouse_wheel.x && lhs.mouse_wheel.y == rhs.mouse_wheel.y &&
+                         lhs.mouse_wheel.precise_x == rhs.mouse_wheel.precise_x && lhs.mouse_wheel.precise_y == rhs.mouse_wheel.precise_y;
+                break;
+            case netput::event_type::window:
+                result = lhs.window.type == rhs.window.type && lhs.window.arg1 == rhs.window.arg1 && lhs.window.arg2 == rhs.window.arg2;
+                break;
+            }
+        }
+        return result;
+    }
+
+    // one session's events in arrival order, sessions interleave freely
+    static std::vector<netput::event> session_events(const std::vector<received> &all, const std::string &session_id)
+    {
+        std::vector<netput::event> result;
+        for (const received &current : all)
+        {
+            if (current.session_id == session_id)
+            {
+                result.push_back(current.record);
+            }
+        }
+        return result;
+    }
+
+    static std::vector<received> record()
+    {
+        running_server server(record_port, recording);
+        for (size_t session = 0; session < 2; session++)
+        {
+            netput::client client(address(record_port));
+            client.connect(reinterpret_cast<const uint8_t *>(session_ids[session].data()), session_ids[session].size());
+            for (size_t index = 0; index < events_per_session; index++)
+            {
+                client.send(make_event(session, index));
+            }
+            client.disconnect();
+        }
+        return server.stop();
+    }
+
+    static std::vector<received> play(netput::replay_stats &stats, uint64_t timestamp_ns)
+    {
+        running_server server(replay_port, "");
+        netput::replay log(recording);
+        netput::replay_options options;
+        options.mode = netput::replay_mode::maximum;
+        options.speed = 1.0;
+        options.timestamp_ns = timestamp_ns;
+        stats = log.play(address(replay_port), options);
+        return server.stop();
+    }
+
+    // a schedule play() cannot keep is refused before anything connects
+    static void expect_rejected(netput::replay &log, netput::replay_mode mode, double speed, uint64_t timestamp_ns, const std::string &what)
+    {
+        netput::replay_options options;
+        bool rejected;
+        options.mode = mode;
+        options.speed = speed;
+        options.timestamp_ns = timestamp_ns;
+        try
+        {
+            log.play(address(replay_port), options);
+            rejected = false;
+        }
+        catch (const std::invalid_argument &)
+        {
+            rejected = true;
+        }
+        internal_test::expect(rejected, "rejects_bad_options", what + " was played");
+    }
+
+    static void round_trip()
+    {
+        std::vector<received> recorded;
+        std::vector<received> replayed;
+        netput::replay_stats stats;
+
+        std::remove(recording.c_str());
+        recorded = record();
+        replayed = play(stats, 1000000);
+        std::remove(recording.c_str());
+
+        if (stats.sessions != 2 || stats.events != 2 * events_per_session)
+        {
+            throw std::runtime_error("replay sent " + std::to_string(stats.sessions) + " sessions and " + std::to_string(stats.events) + " events");
+        }
+        for (size_t session = 0; session < 2; session++)
+        {
+            const std::vector<netput::event> sent = session_events(recorded, session_ids[session]);
+            const std::vector<netput::event> resent = session_events(replayed, session_ids[session]);
+            if (sent.size() != events_per_session || resent.size() != sent.size())
+            {
+                throw std::runtime_error(session_ids[session] + ": " + std::to_string(sent.size()) + " recorded, " + std::to_string(resent.size()) + " replayed");
+            }
+            for (size_t index = 0; index < sent.size(); index++)
+            {
+                if (!same_event(sent[index], make_event(session, index)) || !same_event(resent[index], sent[index]))
+                {
+                    throw std::runtime_error(session_ids[session] + ": event " + std::to_string(index) + " changed");
+                }
+            }
+        }
+    }
+
+    static void rejects_bad_options()
+    {
+        std::vector<received> replayed;
+        netput::replay_stats stats;
+
+        std::remove(recording.c_str());
+        record();
+        {
+            netput::replay log(recording);
+            expect_rejected(log, netput::replay_mode::original, 1.0, 0, "original with timestamp_ns 0");
+            expect_rejected(log, netput::replay_mode::scaled, 2.0, 0, "scaled with timestamp_ns 0");
+            expect_rejected(log, netput::replay_mode::scaled, 0.0, 1000000, "scaled with speed 0");
+        }
+        // maximum ignores the timestamps, 0 is fine there
+        replayed = play(stats, 0);
+        std::remove(recording.c_str());
+        internal_test::expect(stats.events == 2 * events_per_session && replayed.size() == stats.events, "rejects_bad_options", "maximum with timestamp_ns 0 did not play everything");
+    }
+}
+
+int main(int argc, char **argv)
+{
+    return internal_test::run({replay::round_trip, replay::rejects_bad_options});
+}